@@ -8,6 +8,7 @@
 #include "DDRec/Surface.h"
 #include "GeometryHelper.h"
 #include "Math/Point2D.h"
+#include "SharedVolumes.h"
 #include <XML/Helper.h>
 #include <vector>
 
@@ -78,11 +79,9 @@ static tuple<Volume, Position> build_module(Detector& desc, xml::Collection_t& p
   auto   sx  = mod.attr<double>(_Unicode(sizex));
   auto   sy  = mod.attr<double>(_Unicode(sizey));
   auto   sz  = mod.attr<double>(_Unicode(sizez));
-  Box    modShape(sx / 2., sy / 2., sz / 2.);
   auto   modMat = desc.material(mod.attr<string>(_Unicode(material)));
-  Volume modVol("module_vol", modShape, modMat);
-  modVol.setSensitiveDetector(sens);
-  modVol.setVisAttributes(desc.visAttributes(mod.attr<string>(_Unicode(vis))));
+  Volume modVol = epic::geo::sharedBox(desc, "module_vol", sx / 2., sy / 2., sz / 2., modMat,
+                                       mod.attr<string>(_Unicode(vis)), sens);
 
   // no wrapper
   if (!plm.hasChild(_Unicode(wrapper))) {
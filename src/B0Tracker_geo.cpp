@@ -54,7 +54,7 @@ static Ref_t create_B0Tracker(Detector& description, xml_h e, SensitiveDetector
   // Add the volume boundary material if configured
   for (xml_coll_t bmat(x_det, _Unicode(boundary_material)); bmat; ++bmat) {
     xml_comp_t x_boundary_material = bmat;
-    DD4hepDetectorHelper::xmlToProtoSurfaceMaterial(x_boundary_material, params,
+    DD4hepDetectorHelper::xmlToProtoSurfaceMaterial(x_boundary_material, sdet, params,
                                          "boundary_material");
   }
 
@@ -205,7 +205,8 @@ static Ref_t create_B0Tracker(Detector& description, xml_h e, SensitiveDetector
 
     for (xml_coll_t lmat(x_layer, _Unicode(layer_material)); lmat; ++lmat) {
       xml_comp_t x_layer_material = lmat;
-      DD4hepDetectorHelper::xmlToProtoSurfaceMaterial(x_layer_material, layerParams, "layer_material");
+      DD4hepDetectorHelper::xmlToProtoSurfaceMaterial(x_layer_material, layer_element, layerParams,
+                                                      "layer_material");
     }
 
     for (xml_coll_t ri(x_layer, _U(ring)); ri; ++ri) {
@@ -15,6 +15,8 @@
 //     issue dealing with it. C. Peng
 
 #include "DD4hep/DetFactoryHelper.h"
+#include "GeometryDetail.h"
+#include "GeometryHelpers.h"
 #include "Math/Point2D.h"
 #include "TGeoPolygon.h"
 #include "XML/Layering.h"
@@ -25,14 +27,14 @@ using namespace dd4hep::detail;
 
 typedef ROOT::Math::XYPoint Point;
 // fiber placement helpers, defined below
-vector<vector<Point>> fiberPositions(double radius, double x_spacing, double z_spacing, double x, double z, double phi,
-                                     double spacing_tol = 1e-2);
-std::pair<int, int>   getNdivisions(double x, double z, double dx, double dz);
+std::pair<int, int>                            getNdivisions(double x, double z, double dx, double dz);
 vector<tuple<int, Point, Point, Point, Point>> gridPoints(int div_x, int div_z, double x, double z, double phi);
 
 // geometry helpers
 void buildFibers(Detector& desc, SensitiveDetector& sens, Volume& mother, xml_comp_t x_fiber,
                  const std::tuple<double, double, double, double>& dimensions);
+void homogenizeFibers(Detector& desc, SensitiveDetector& sens, Volume& mother, xml_comp_t x_fiber,
+                      const std::tuple<double, double, double, double>& dimensions);
 void buildSupport(Detector& desc, Volume& mother, xml_comp_t x_support,
                   const std::tuple<double, double, double, double>& dimensions);
 
@@ -58,6 +60,7 @@ static Ref_t create_detector(Detector& desc, xml_h e, SensitiveDetector sens)
   Transform3D  tr_global = Translation3D(0, 0, offset) * RotationZ(hphi);
   PlacedVolume env_phv   = motherVol.placeVolume(envelope, tr_global);
   sens.setType("calorimeter");
+  bool coarse = epic::geo::isCoarse(desc);
 
   env_phv.addPhysVolID("system", det_id);
   sdet.setPlacement(env_phv);
@@ -116,7 +119,11 @@ static Ref_t create_detector(Detector& desc, xml_h e, SensitiveDetector sens)
 
           // build fibers
           if (x_slice.hasChild(_Unicode(fiber))) {
-            buildFibers(desc, sens, s_vol, x_slice.child(_Unicode(fiber)), {s_trd_x1, s_thick, l_dim_y, hphi});
+            if (coarse) {
+              homogenizeFibers(desc, sens, s_vol, x_slice.child(_Unicode(fiber)), {s_trd_x1, s_thick, l_dim_y, hphi});
+            } else {
+              buildFibers(desc, sens, s_vol, x_slice.child(_Unicode(fiber)), {s_trd_x1, s_thick, l_dim_y, hphi});
+            }
           }
 
           if (x_slice.isSensitive()) {
@@ -203,27 +210,24 @@ void buildFibers(Detector& desc, SensitiveDetector& sens, Volume& s_vol, xml_com
   Volume f_vol_core("fiber_core_vol", f_tube_core, desc.material(x_fiber.materialStr()));
 
   vector<int> f_id_count(grid_div.first * grid_div.second, 0);
-  auto        f_pos = fiberPositions(f_radius, f_spacing_x, f_spacing_z, s_trd_x1, s_thick, hphi);
-  // std::cout << f_pos.size() << " lines, ~" << f_pos.front().size() << " fibers each line" << std::endl;
-  for (size_t il = 0; il < f_pos.size(); ++il) {
-    auto& line = f_pos[il];
-    if (line.empty()) {
+  // fiber lattice in the x-z plane of the trapezoid, one line of fibers per row
+  auto f_pos = epic::geo::honeycombTrapezoid(f_radius, f_spacing_x, f_spacing_z, s_trd_x1, s_thick, hphi);
+  for (size_t il = 0; il < f_pos.nrows(); ++il) {
+    size_t f_begin = f_pos.row_begin[il];
+    size_t f_end   = f_pos.row_begin[il + 1];
+    if (f_begin == f_end) {
       continue;
     }
-    double l_pos_y = line.front().y();
+    double l_pos_y = f_pos.y[f_begin];
     // use assembly as intermediate volume container to reduce number of daughter volumes
     Assembly lfibers_clad(Form("fiber_clad_array_line_%lu", il));
     Assembly lfibers_core(Form("fiber_core_array_line_%lu", il));
-    for (auto& p : line) {
+    for (size_t jf = f_begin; jf < f_end; ++jf) {
+      Point p(f_pos.x[jf], f_pos.y[jf]);
       int f_grid_id = -1;
       int f_id      = -1;
       // Check to which grid fiber belongs to
       for (auto& poly_vtx : grid_vtx) {
-        if (p.y() != l_pos_y) {
-          std::cerr << Form("Expected the same y position from a same line: %.2f, but got %.2f", l_pos_y, p.y())
-                    << std::endl;
-          continue;
-        }
         auto [grid_id, vtx_a, vtx_b, vtx_c, vtx_d] = poly_vtx;
         double poly_x[4]                           = {vtx_a.x(), vtx_b.x(), vtx_c.x(), vtx_d.x()};
         double poly_y[4]                           = {vtx_a.y(), vtx_b.y(), vtx_c.y(), vtx_d.y()};
@@ -260,6 +264,29 @@ void buildFibers(Detector& desc, SensitiveDetector& sens, Volume& s_vol, xml_com
   }
 }
 
+// Coarse detail level: instead of placing the fibers, fill the slice with the equivalent fiber/absorber mixture
+void homogenizeFibers(Detector& desc, SensitiveDetector& sens, Volume& s_vol, xml_comp_t x_fiber,
+                      const std::tuple<double, double, double, double>& dimensions)
+{
+  auto [s_trd_x1, s_thick, s_length, hphi] = dimensions;
+  double f_radius                          = getAttrOrDefault(x_fiber, _U(radius), 0.1 * cm);
+  double f_spacing_x                       = getAttrOrDefault(x_fiber, _Unicode(spacing_x), 0.122 * cm);
+  double f_spacing_z                       = getAttrOrDefault(x_fiber, _Unicode(spacing_z), 0.134 * cm);
+
+  // fibers run along the full slice length, so the volume fraction is the cross section fraction
+  size_t nfibers    = epic::geo::honeycombTrapezoidCount(f_radius, f_spacing_x, f_spacing_z, s_trd_x1, s_thick, hphi);
+  double s_area     = (2. * s_trd_x1 + s_thick * std::tan(hphi)) * s_thick;
+  double fiber_frac = nfibers * M_PI * f_radius * f_radius / s_area;
+
+  Material s_mat = s_vol.material();
+  Material f_mat = desc.material(x_fiber.materialStr());
+  s_vol.setMaterial(epic::geo::mixMaterial(desc, Form("%s_%s_ScFi%.6f", s_mat.name(), f_mat.name(), fiber_frac),
+                                           {{s_mat, 1. - fiber_frac}, {f_mat, fiber_frac}}));
+  if (x_fiber.isSensitive()) {
+    s_vol.setSensitiveDetector(sens);
+  }
+}
+
 // DAWN view seems to have some issue with overlapping solids even if they were unions
 // The support is now built without overlapping
 void buildSupport(Detector& desc, Volume& mod_vol, xml_comp_t x_support,
@@ -349,45 +376,10 @@ void buildSupport(Detector& desc, Volume& mod_vol, xml_comp_t x_support,
   mod_vol.placeVolume(env_vol, Position(0.0, 0.0, l_pos_z + support_thickness / 2.));
 }
 
-// Fill fiber lattice into trapezoid starting from position (0,0) in x-z coordinate system
-vector<vector<Point>> fiberPositions(double radius, double x_spacing, double z_spacing, double x, double z, double phi,
-                                     double spacing_tol)
-{
-  // z_spacing - distance between fiber layers in z
-  // x_spacing - distance between fiber centers in x
-  // x - half-length of the shorter (bottom) base of the trapezoid
-  // z - height of the trapezoid
-  // phi - angle between z and trapezoid arm
-
-  vector<vector<Point>> positions;
-  int z_layers = floor((z / 2 - radius - spacing_tol) / z_spacing); // number of layers that fit in z/2
-
-  double z_pos = 0.;
-  double x_pos = 0.;
-
-  for (int l = -z_layers; l < z_layers + 1; l++) {
-    vector<Point> xline;
-    z_pos        = l * z_spacing;
-    double x_max = x + (z / 2. + z_pos) * tan(phi) - spacing_tol; // calculate max x at particular z_pos
-    (l % 2 == 0) ? x_pos = 0. : x_pos = x_spacing / 2;            // account for spacing/2 shift
-
-    while (x_pos < (x_max - radius)) {
-      xline.push_back(Point(x_pos, z_pos));
-      if (x_pos != 0.)
-        xline.push_back(Point(-x_pos, z_pos)); // using symmetry around x=0
-      x_pos += x_spacing;
-    }
-    // Sort fiber IDs for a better organization
-    sort(xline.begin(), xline.end(), [](const Point& p1, const Point& p2) { return p1.x() < p2.x(); });
-    positions.emplace_back(std::move(xline));
-  }
-  return positions;
-}
-
 // Calculate number of divisions for the readout grid for the fiber layers
 std::pair<int, int> getNdivisions(double x, double z, double dx, double dz)
 {
-  // x and z defined as in vector<Point> fiberPositions
+  // x and z defined as in epic::geo::honeycombTrapezoid
   // dx, dz - size of the grid in x and z we want to get close to with the polygons
   // See also descripltion when the function is called
 
@@ -420,7 +412,7 @@ std::pair<int, int> getNdivisions(double x, double z, double dx, double dz)
 // Calculate dimensions of the polygonal grid in the cartesian coordinate system x-z
 vector<tuple<int, Point, Point, Point, Point>> gridPoints(int div_x, int div_z, double x, double z, double phi)
 {
-  // x, z and phi defined as in vector<Point> fiberPositions
+  // x, z and phi defined as in epic::geo::honeycombTrapezoid
   // div_x, div_z - number of divisions in x and z
   double dz = z / div_z;
 
@@ -19,14 +19,68 @@
 //==========================================================================
 #include "DD4hep/DetFactoryHelper.h"
 #include "DD4hep/Printout.h"
+#include "MeshCache.h"
 #include "XML/Layering.h"
 
 #include "TVector3.h"
 
+#include <fmt/core.h>
+
+#include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+
 using namespace std;
 using namespace dd4hep;
 using namespace dd4hep::detail;
 
+// version of the conversion of the <tessellated> definitions into mesh vertices and facets, part of the
+// mesh cache key: bump it whenever this builder changes the meshes it closes (e.g. vertex order or flips)
+static constexpr const char* mesh_builder_version = "epic_HcalBarrelGDML mesh 1";
+
+// parse a plain number (no units or expressions), malformed input reads as zero like atof
+static double parse_number(std::string_view str)
+{
+  while (!str.empty() && (std::isspace(static_cast<unsigned char>(str.front())) || str.front() == '+')) {
+    str.remove_prefix(1);
+  }
+  double value = 0.;
+  if (std::from_chars(str.data(), str.data() + str.size(), value).ec != std::errc()) {
+    return 0.;
+  }
+  return value;
+}
+
+// numeric attribute of an element, a missing attribute reads as zero
+static double attr_number(xml_h x, const xml::XmlChar* name)
+{
+  const xml::XmlChar* value = x.attr_value_nothrow(name);
+  return value == nullptr ? 0. : parse_number(xml::_toString(value));
+}
+
+// Placement of a tile in its tower
+struct TilePlacement {
+  Volume        volume;
+  Assembly      tower;
+  int           copy;
+  int           id;
+  double        phi;          // rotation of the tile column around the beam axis
+  double        plane_rotate; // tilt of the tile plane
+  double        flip;         // rotation of the tile around its y axis
+  Translation3D offset;       // position of the tile in the tile plane
+};
+
+// Placement of a tower in a sector, or of a sector in the envelope, rotated around the beam axis
+struct AssemblyPlacement {
+  Volume mother;
+  Volume daughter;
+  int    copy;
+  int    id;
+  double phi;
+};
+
 static Ref_t create_detector(Detector& description, xml_h e, SensitiveDetector sens)
 {
 
@@ -72,6 +126,9 @@ static Ref_t create_detector(Detector& description, xml_h e, SensitiveDetector s
   Assembly ChimneyTower[4];
   Assembly Tower[24];
 
+  // Tile placements, collected while the tile solids are built
+  std::vector<TilePlacement> tiles;
+
   xml_comp_t det_define = x_det.child("define");
 
   // Pick up the constants
@@ -190,6 +247,27 @@ static Ref_t create_detector(Detector& description, xml_h e, SensitiveDetector s
     aptr->push_back(atof(mtrx_values.c_str()));
   }
 
+  // Optional binary cache of the closed tessellated solids, keyed by the hash of the compact file which defines them
+  // and the builder version
+  std::string mesh_cache_dir =
+      epic::geo::meshCacheDirectory(getAttrOrDefault<std::string>(x_det, _Unicode(mesh_cache), ""));
+  std::string        mesh_cache_file;
+  std::uint64_t      mesh_cache_key = 0;
+  epic::geo::MeshMap cached_meshes, new_meshes;
+  if (!mesh_cache_dir.empty()) {
+    std::string source = e.document().uri();
+    mesh_cache_key     = epic::geo::fileHash(source, mesh_builder_version);
+    if (mesh_cache_key != 0) {
+      mesh_cache_file = fmt::format("{}/{}_{:016x}.mesh", mesh_cache_dir, det_name, mesh_cache_key);
+      if (epic::geo::readMeshCache(mesh_cache_file, mesh_cache_key, cached_meshes)) {
+        printout(INFO, "BarrelHCalCalorimeter", "loaded %zu tessellated solids from %s", cached_meshes.size(),
+                 mesh_cache_file.c_str());
+      }
+    } else {
+      printout(WARNING, "BarrelHCalCalorimeter", "cannot read %s, mesh cache disabled", source.c_str());
+    }
+  }
+
   // Loop over the solids, create them and add them to the detector volume
 
   for (xml_coll_t k(x_solids, _Unicode(solid)); k; ++k) {
@@ -204,80 +282,79 @@ static Ref_t create_detector(Detector& description, xml_h e, SensitiveDetector s
     std::string solidMatString = getAttrOrDefault<std::string>(x_solid, _Unicode(material), " ");
     Material    solid_material = description.material(solidMatString);
 
-    double offset_x = atof(getAttrOrDefault<std::string>(x_solid, _Unicode(x), "0").c_str()) * dd4hep::mm;
-    double offset_y = atof(getAttrOrDefault<std::string>(x_solid, _Unicode(y), "0").c_str()) * dd4hep::mm;
-    double offset_z = atof(getAttrOrDefault<std::string>(x_solid, _Unicode(z), "0").c_str()) * dd4hep::mm;
-
-    // Get the vertices
-    std::vector<Tessellated::Vertex_t> vertices;
-    for (xml_coll_t j(define, _Unicode(position)); j; ++j) {
-      xml_comp_t pos = j;
+    // Take the closed solid from the mesh cache, or build it from the vertex and facet definitions
+    TessellatedSolid solid;
+    auto             cached = cached_meshes.find(solid_name);
+    if (cached != cached_meshes.end()) {
+      solid = epic::geo::solidFromMesh(solid_name, cached->second);
+    } else {
+      double offset_x = attr_number(x_solid, _Unicode(x)) * dd4hep::mm;
+      double offset_y = attr_number(x_solid, _Unicode(y)) * dd4hep::mm;
+      double offset_z = attr_number(x_solid, _Unicode(z)) * dd4hep::mm;
 
-      // create the vertex point
+      // Get the vertices, and index them by name for the facets (the first definition of a name wins)
+      std::vector<Tessellated::Vertex_t>   vertices;
+      std::unordered_map<std::string, int> vertex_index;
+      for (xml_coll_t j(define, _Unicode(position)); j; ++j) {
+        xml_comp_t pos = j;
 
-      double xp = atof(getAttrOrDefault<std::string>(pos, _Unicode(x), "0").c_str()) * dd4hep::mm - offset_x;
-      double yp = atof(getAttrOrDefault<std::string>(pos, _Unicode(y), "0").c_str()) * dd4hep::mm - offset_y;
-      double zp = atof(getAttrOrDefault<std::string>(pos, _Unicode(z), "0").c_str()) * dd4hep::mm - offset_z;
+        int vtx = static_cast<int>(vertices.size());
+        vertex_index.emplace(getAttrOrDefault<std::string>(pos, _Unicode(name), " "), vtx);
 
-      // for the sector plates  we perform a rotation around y - the chimney cutout should be in the
-      // electron arm
+        // create the vertex point
 
-      if ((solid_name == "HCAL_Chimney_Sector_Half_Plate") || (solid_name == "HCAL_Chimney_Sector_Plate") ||
-          (solid_name == "HCAL_Sector_Half_Plate") || (solid_name == "HCAL_Sector_Plate")) {
-        xp = -xp;
-        zp = -zp;
-      }
+        double xp = attr_number(pos, _Unicode(x)) * dd4hep::mm - offset_x;
+        double yp = attr_number(pos, _Unicode(y)) * dd4hep::mm - offset_y;
+        double zp = attr_number(pos, _Unicode(z)) * dd4hep::mm - offset_z;
 
-      Tessellated::Vertex_t thisPoint(xp, yp, zp);
+        // for the sector plates  we perform a rotation around y - the chimney cutout should be in the
+        // electron arm
 
-      vertices.push_back(thisPoint);
-    }
+        if ((solid_name == "HCAL_Chimney_Sector_Half_Plate") || (solid_name == "HCAL_Chimney_Sector_Plate") ||
+            (solid_name == "HCAL_Sector_Half_Plate") || (solid_name == "HCAL_Sector_Plate")) {
+          xp = -xp;
+          zp = -zp;
+        }
 
-    TessellatedSolid solid(solid_name.c_str(), vertices);
+        Tessellated::Vertex_t thisPoint(xp, yp, zp);
 
-    for (xml_coll_t i(tessellated, _Unicode(triangular)); i; ++i) {
-      xml_comp_t triang = i;
-
-      int vtx1 = -1;
-      int vtx2 = -1;
-      int vtx3 = -1;
+        vertices.push_back(thisPoint);
+      }
 
-      std::string facetName1 = getAttrOrDefault<std::string>(triang, _Unicode(vertex1), " ");
-      std::string facetName2 = getAttrOrDefault<std::string>(triang, _Unicode(vertex2), " ");
-      std::string facetName3 = getAttrOrDefault<std::string>(triang, _Unicode(vertex3), " ");
+      solid = TessellatedSolid(solid_name.c_str(), vertices);
 
-      // Search the define collection to match things up
-      int idx = 0;
-      for (xml_coll_t j(define, _Unicode(position)); j; ++j) {
-        xml_comp_t  pos     = j;
-        std::string posName = getAttrOrDefault<std::string>(pos, _Unicode(name), " ");
+      // index of a named vertex, -1 if it is not defined
+      auto find_vertex = [&vertex_index](const std::string& name) {
+        auto it = vertex_index.find(name);
+        return it == vertex_index.end() ? -1 : it->second;
+      };
 
-        if (posName == facetName1)
-          vtx1 = idx;
-        if (posName == facetName2)
-          vtx2 = idx;
-        if (posName == facetName3)
-          vtx3 = idx;
+      for (xml_coll_t i(tessellated, _Unicode(triangular)); i; ++i) {
+        xml_comp_t triang = i;
 
-        if ((vtx1 >= 0) && (vtx2 >= 0) && (vtx3 >= 0))
-          break;
+        int vtx1 = find_vertex(getAttrOrDefault<std::string>(triang, _Unicode(vertex1), " "));
+        int vtx2 = find_vertex(getAttrOrDefault<std::string>(triang, _Unicode(vertex2), " "));
+        int vtx3 = find_vertex(getAttrOrDefault<std::string>(triang, _Unicode(vertex3), " "));
 
-        idx++;
-      }
+        // Add the facet to the solid
 
-      // Add the facet to the solid
+        if ((vtx1 >= 0) && (vtx2 >= 0) && (vtx3 >= 0) && (vtx1 != vtx2) && (vtx1 != vtx3) && (vtx2 != vtx3)) {
 
-      if ((vtx1 >= 0) && (vtx2 >= 0) && (vtx3 >= 0) && (vtx1 != vtx2) && (vtx1 != vtx3) && (vtx2 != vtx3)) {
+          solid->AddFacet(vtx1, vtx2, vtx3);
 
-        solid->AddFacet(vtx1, vtx2, vtx3);
+        } else
+          printout(WARNING, "BarrelHCalCalorimeter", "bad facet! %d %d %d", vtx1, vtx2, vtx3);
+      }
 
-      } else
-        printout(WARNING, "BarrelHCalCalorimeter", "bad facet! %d %d %d", vtx1, vtx2, vtx3);
+      // Complete the shape, only shapes which pass the closure checks are cached
+      bool            closed = solid->CloseShape(true, true, true);
+      epic::geo::Mesh mesh;
+      if (!mesh_cache_file.empty() && closed && epic::geo::meshFromSolid(solid, mesh)) {
+        printout(DEBUG, "BarrelHCalCalorimeter", "adding %s to the mesh cache", solid_name.c_str());
+        new_meshes.emplace(solid_name, std::move(mesh));
+      }
     }
 
-    // Complete the shape
-    solid->CloseShape(true, true, true);
-
     Volume solidVolume(solid_name, solid, solid_material);
     solidVolume.setVisAttributes(description, x_det.visStr());
 
@@ -332,7 +409,8 @@ static Ref_t create_detector(Detector& description, xml_h e, SensitiveDetector s
     } else {
 
       // If it's not sectors then it's a tile - for these we build an assembly to get the full array of tiles
-      // Offsets and rotation are to properly orient the tiles in the assembly.
+      // Offsets and rotation are to properly orient the tiles in the assembly. The tiles are placed from the
+      // table once all solids are known.
 
       if (solid_name.size() > 0) {
 
@@ -343,106 +421,42 @@ static Ref_t create_detector(Detector& description, xml_h e, SensitiveDetector s
           std::string stnum = solid_name.substr(solid_name.size() - 2, solid_name.size());
           int         tnum  = atoi(stnum.c_str()) - 1;
 
-          Assembly TempTower1(_toString(11 - tnum, "Tower%i"));
-          Assembly TempTower2(_toString(12 + tnum, "Tower%i"));
-
           solidVolume.setSensitiveDetector(sens);
 
-          DetElement tile_det("tile0", det_id);
-
           if (type == "OuterHCalTile") {
 
-            Tower[11 - tnum] = TempTower1;
-            Tower[12 + tnum] = TempTower2;
+            Tower[11 - tnum] = Assembly(_toString(11 - tnum, "Tower%i"));
+            Tower[12 + tnum] = Assembly(_toString(12 + tnum, "Tower%i"));
 
-            for (int i = 0; i < 5; i++) {
+            // the first eight tile types are flipped on the north side, the others on the south side
+            double flipS = (tnum < 8) ? 0.0 : 180.0 * dd4hep::deg;
+            double flipN = (tnum < 8) ? 180.0 * dd4hep::deg : 0.0;
+
+            Translation3D offsetS((xposTileS[tnum] + (tnum + 1) * tile_tolerance) * dd4hep::mm,
+                                  yposTileS[tnum] * dd4hep::mm, zposTileS[tnum] * dd4hep::mm);
+            Translation3D offsetN((xposTileN[tnum] - (tnum + 1) * tile_tolerance) * dd4hep::mm,
+                                  yposTileN[tnum] * dd4hep::mm, zposTileN[tnum] * dd4hep::mm);
 
-              if (tnum < 8) {
-
-                PlacedVolume phv0 = Tower[11 - tnum].placeVolume(
-                    solidVolume, i,
-                    RotationZ(octileRotateStart + i * (360.0 / 320.0) * dd4hep::deg) *
-                        Transform3D(RotationY(90.0 * dd4hep::deg),
-                                    Translation3D(xposOuter[0] * dd4hep::mm, yposOuter[0] * dd4hep::mm, 0.0)) *
-                        RotationX(-tilePlaneRotate * dd4hep::deg) *
-                        Transform3D(RotationY(0.0),
-                                    Translation3D((xposTileS[tnum] + (tnum + 1) * tile_tolerance) * dd4hep::mm,
-                                                  yposTileS[tnum] * dd4hep::mm, zposTileS[tnum] * dd4hep::mm)));
-
-                phv0.addPhysVolID("tile", i + (11 - tnum) * 10);
-                DetElement sd0 = tile_det.clone(_toString(i + (11 - tnum) * 10, "tile%d"));
-                sd0.setPlacement(phv0);
-                sdet.add(sd0);
-
-                PlacedVolume phv1 = Tower[12 + tnum].placeVolume(
-                    solidVolume, i + 5,
-                    RotationZ(octileRotateStart + i * (360.0 / 320.0) * dd4hep::deg) *
-                        Transform3D(RotationY(90.0 * dd4hep::deg),
-                                    Translation3D(xposOuter[0] * dd4hep::mm, yposOuter[0] * dd4hep::mm, 0.0)) *
-                        RotationX(-tilePlaneRotate * dd4hep::deg) *
-                        Transform3D(RotationY(180.0 * dd4hep::deg),
-                                    Translation3D((xposTileN[tnum] - (tnum + 1) * tile_tolerance) * dd4hep::mm,
-                                                  yposTileN[tnum] * dd4hep::mm, zposTileN[tnum] * dd4hep::mm)));
-                phv1.addPhysVolID("tile", i + 5 + (12 + tnum) * 10);
-                DetElement sd1 = tile_det.clone(_toString(i + 5 + (12 + tnum) * 10, "tile%d"));
-                sd1.setPlacement(phv1);
-                sdet.add(sd1);
-
-              } else {
-
-                PlacedVolume phv0 = Tower[11 - tnum].placeVolume(
-                    solidVolume, i,
-                    RotationZ(octileRotateStart + i * (360.0 / 320.0) * dd4hep::deg) *
-                        Transform3D(RotationY(90.0 * dd4hep::deg),
-                                    Translation3D(xposOuter[0] * dd4hep::mm, yposOuter[0] * dd4hep::mm, 0.0)) *
-                        RotationX(-tilePlaneRotate * dd4hep::deg) *
-                        Transform3D(RotationY(180.0 * dd4hep::deg),
-                                    Translation3D((xposTileS[tnum] + (tnum + 1) * tile_tolerance) * dd4hep::mm,
-                                                  yposTileS[tnum] * dd4hep::mm, zposTileS[tnum] * dd4hep::mm)));
-
-                phv0.addPhysVolID("tile", i + (11 - tnum) * 10);
-                DetElement sd0 = tile_det.clone(_toString(i + (11 - tnum) * 10, "tile%d"));
-                sd0.setPlacement(phv0);
-                sdet.add(sd0);
-
-                PlacedVolume phv1 = Tower[12 + tnum].placeVolume(
-                    solidVolume, i + 5,
-                    RotationZ(octileRotateStart + i * (360.0 / 320.0) * dd4hep::deg) *
-                        Transform3D(RotationY(90.0 * dd4hep::deg),
-                                    Translation3D(xposOuter[0] * dd4hep::mm, yposOuter[0] * dd4hep::mm, 0.0)) *
-                        RotationX(-tilePlaneRotate * dd4hep::deg) *
-                        Transform3D(RotationY(0.0),
-                                    Translation3D((xposTileN[tnum] - (tnum + 1) * tile_tolerance) * dd4hep::mm,
-                                                  yposTileN[tnum] * dd4hep::mm, zposTileN[tnum] * dd4hep::mm)));
-                phv1.addPhysVolID("tile", i + 5 + (12 + tnum) * 10);
-                DetElement sd1 = tile_det.clone(_toString(i + 5 + (12 + tnum) * 10, "tile%d"));
-                sd1.setPlacement(phv1);
-                sdet.add(sd1);
-              }
+            for (int i = 0; i < 5; i++) {
+              double phi = octileRotateStart + i * (360.0 / 320.0) * dd4hep::deg;
+              tiles.push_back({solidVolume, Tower[11 - tnum], i, i + (11 - tnum) * 10, phi,
+                               tilePlaneRotate * dd4hep::deg, flipS, offsetS});
+              tiles.push_back({solidVolume, Tower[12 + tnum], i + 5, i + 5 + (12 + tnum) * 10, phi,
+                               tilePlaneRotate * dd4hep::deg, flipN, offsetN});
             }
           }
 
           if ((tnum > 7) && (type == "OuterHCalChimneyTile")) {
 
-            Assembly TempChimneyTower1(_toString(11 - tnum, "ChimneyTower%i"));
-            ChimneyTower[11 - tnum] = TempChimneyTower1;
+            ChimneyTower[11 - tnum] = Assembly(_toString(11 - tnum, "ChimneyTower%i"));
 
-            for (int i = 0; i < 5; i++) {
+            Translation3D offset((xposChimneyTileS[tnum - 8] + (tnum + 1) * tile_tolerance) * dd4hep::mm,
+                                 yposChimneyTileS[tnum - 8] * dd4hep::mm, zposChimneyTileS[tnum - 8] * dd4hep::mm);
 
-              PlacedVolume phv = ChimneyTower[11 - tnum].placeVolume(
-                  solidVolume, i,
-                  RotationZ(ctileRotateStart + i * (360.0 / 320.0) * dd4hep::deg) *
-                      Transform3D(RotationY(90.0 * dd4hep::deg),
-                                  Translation3D(xposOuter[0] * dd4hep::mm, yposOuter[0] * dd4hep::mm, 0.0)) *
-                      RotationX(-ctilePlaneRotate * dd4hep::deg) *
-                      Transform3D(RotationY(0.0),
-                                  Translation3D((xposChimneyTileS[tnum - 8] + (tnum + 1) * tile_tolerance) * dd4hep::mm,
-                                                yposChimneyTileS[tnum - 8] * dd4hep::mm,
-                                                zposChimneyTileS[tnum - 8] * dd4hep::mm)));
-              phv.addPhysVolID("tile", i + (11 - tnum) * 10 + 480);
-              DetElement sd = tile_det.clone(_toString(i + (11 - tnum) * 10 + 480, "tile%d"));
-              sd.setPlacement(phv);
-              sdet.add(sd);
+            for (int i = 0; i < 5; i++) {
+              tiles.push_back({solidVolume, ChimneyTower[11 - tnum], i, i + (11 - tnum) * 10 + 480,
+                               ctileRotateStart + i * (360.0 / 320.0) * dd4hep::deg, ctilePlaneRotate * dd4hep::deg,
+                               0.0, offset});
             }
           }
 
@@ -454,101 +468,78 @@ static Ref_t create_detector(Detector& description, xml_h e, SensitiveDetector s
     }
   }
 
-  // Place the sector tile assemblies into the sectors
+  // Store the newly closed solids together with the cached ones
+  if (!new_meshes.empty()) {
+    new_meshes.merge(cached_meshes);
+    if (!epic::geo::writeMeshCache(mesh_cache_file, mesh_cache_key, new_meshes)) {
+      // e.g. a read-only installation, the solids are then closed again on the next load
+      printout(INFO, "BarrelHCalCalorimeter", "cannot write mesh cache %s", mesh_cache_file.c_str());
+    }
+  }
 
-  sens.setType("calorimeter");
+  // Place the tiles into the towers
 
-  DetElement tower_det("tower0", det_id);
+  sens.setType("calorimeter");
 
-  // special chimney sector towers
-  for (int i = 0; i < 4; i++) {
-
-    PlacedVolume tower_phv0 = ChimneySector.placeVolume(
-        ChimneyTower[i], i, Transform3D(RotationZ(tweak_chimney_tiles[i]), Translation3D(0.0, 0.0, 0.0)));
-    tower_phv0.addPhysVolID("tower", i);
-    DetElement sd0 = tower_det.clone(_toString(i, "tower%d"));
-    sd0.setPlacement(tower_phv0);
-    sdet.add(sd0);
-
-    PlacedVolume tower_phv1 =
-        ChimneySector.placeVolume(ChimneyTower[i], i + 24,
-                                  Transform3D(RotationZ(5 * (360.0 / 320.0) * dd4hep::deg + tweak_chimney_tiles[i]),
-                                              Translation3D(0.0, 0.0, 0.0)));
-    tower_phv1.addPhysVolID("tower", i + 24);
-    DetElement sd1 = tower_det.clone(_toString(i + 24, "tower%d"));
-    sd1.setPlacement(tower_phv1);
-    sdet.add(sd1);
+  Translation3D outer_offset(xposOuter[0] * dd4hep::mm, yposOuter[0] * dd4hep::mm, 0.0);
+  DetElement    tile_det("tile0", det_id);
+  for (const auto& tile : tiles) {
+    PlacedVolume phv = tile.tower.placeVolume(tile.volume, tile.copy,
+                                              RotationZ(tile.phi) *
+                                                  Transform3D(RotationY(90.0 * dd4hep::deg), outer_offset) *
+                                                  RotationX(-tile.plane_rotate) *
+                                                  Transform3D(RotationY(tile.flip), tile.offset));
+    phv.addPhysVolID("tile", tile.id);
+    DetElement sd = tile_det.clone(_toString(tile.id, "tile%d"));
+    sd.setPlacement(phv);
+    sdet.add(sd);
   }
 
-  // ordinary towers in chimney sectors
-  for (int i = 4; i < 24; i++) {
-
-    PlacedVolume tower_phv0 = ChimneySector.placeVolume(
-        Tower[i], i, Transform3D(RotationZ(tweak_chimney_tiles[i]), Translation3D(0.0, 0.0, 0.0)));
-    tower_phv0.addPhysVolID("tower", i);
-    DetElement sd0 = tower_det.clone(_toString(i, "tower%d"));
-    sd0.setPlacement(tower_phv0);
-    sdet.add(sd0);
-
-    PlacedVolume tower_phv1 =
-        ChimneySector.placeVolume(Tower[i], i + 24,
-                                  Transform3D(RotationZ(5 * (360.0 / 320.0) * dd4hep::deg + tweak_chimney_tiles[i]),
-                                              Translation3D(0.0, 0.0, 0.0)));
-    tower_phv1.addPhysVolID("tower", i + 24);
-    DetElement sd1 = tower_det.clone(_toString(i + 24, "tower%d"));
-    sd1.setPlacement(tower_phv1);
-    sdet.add(sd1);
-  }
+  // Place the sector tile assemblies into the sectors: chimney sectors hold the four chimney towers instead of
+  // the first four ordinary towers, ordinary sectors are offset to align with their sector plates
 
-  // ordinary sectors
+  std::vector<AssemblyPlacement> towers;
   for (int i = 0; i < 24; i++) {
-
-    PlacedVolume tower_phv0 = Sector.placeVolume(
-        Tower[i], i + 24,
-        Transform3D(RotationZ(tileRotateStart - octileRotateStart + tweak_tiles[i]), Translation3D(0.0, 0.0, 0.0)));
-    tower_phv0.addPhysVolID("tower", i + 48);
-    DetElement sd0 = tower_det.clone(_toString(i + 48, "tower%d"));
-    sd0.setPlacement(tower_phv0);
-    sdet.add(sd0);
-
-    PlacedVolume tower_phv1 = Sector.placeVolume(
-        Tower[i], i + 48,
-        Transform3D(RotationZ(tileRotateStart - octileRotateStart + 5 * (360.0 / 320.0) * dd4hep::deg + tweak_tiles[i]),
-                    Translation3D(0.0, 0.0, 0.0)));
-    tower_phv1.addPhysVolID("tower", i + 72);
-    DetElement sd1 = tower_det.clone(_toString(i + 72, "tower%d"));
-    sd1.setPlacement(tower_phv1);
-    sdet.add(sd1);
+    Volume tower = (i < 4) ? Volume(ChimneyTower[i]) : Volume(Tower[i]);
+    towers.push_back({ChimneySector, tower, i, i, tweak_chimney_tiles[i]});
+    towers.push_back(
+        {ChimneySector, tower, i + 24, i + 24, 5 * (360.0 / 320.0) * dd4hep::deg + tweak_chimney_tiles[i]});
+  }
+  for (int i = 0; i < 24; i++) {
+    towers.push_back({Sector, Tower[i], i + 24, i + 48, tileRotateStart - octileRotateStart + tweak_tiles[i]});
+    towers.push_back({Sector, Tower[i], i + 48, i + 72,
+                      tileRotateStart - octileRotateStart + 5 * (360.0 / 320.0) * dd4hep::deg + tweak_tiles[i]});
   }
 
-  // Place the sectors into the envelope
-
-  DetElement sector_det("sector0", det_id);
-
-  // Chimney sectors
-  for (int i = -1; i < 2; i++) {
-    PlacedVolume sect_phv = envelope.placeVolume(
-        ChimneySector, i + 1,
-        Transform3D(RotationZ(((i - 1) * 2 * M_PI / 32) + tweak_sectors[i + 1]), Translation3D(0, 0, 0)));
-    sect_phv.addPhysVolID("system", det_id);
-    sect_phv.addPhysVolID("barrel", 0);
-    sect_phv.addPhysVolID("sector", i + 1);
-    DetElement sd = sector_det.clone(_toString(i + 1, "sector%d"));
-    sd.setPlacement(sect_phv);
+  DetElement tower_det("tower0", det_id);
+  for (const auto& tower : towers) {
+    PlacedVolume tower_phv = tower.mother.placeVolume(tower.daughter, tower.copy,
+                                                      Transform3D(RotationZ(tower.phi), Translation3D(0.0, 0.0, 0.0)));
+    tower_phv.addPhysVolID("tower", tower.id);
+    DetElement sd = tower_det.clone(_toString(tower.id, "tower%d"));
+    sd.setPlacement(tower_phv);
     sdet.add(sd);
   }
 
-  // Normal sectors
+  // Place the sectors into the envelope: three chimney sectors, then the normal sectors
 
+  std::vector<AssemblyPlacement> sectors;
+  for (int i = 0; i < 3; i++) {
+    sectors.push_back({envelope, ChimneySector, i, i, ((i - 2) * 2 * M_PI / 32) + tweak_sectors[i]});
+  }
   for (int i = 3; i < 32; i++) {
-    PlacedVolume sect_phv =
-        envelope.placeVolume(Sector, i,
-                             Transform3D(RotationZ((-2.075 * M_PI / 32) + (i - 3) * (2 * M_PI / 32) + tweak_sectors[i]),
-                                         Translation3D(0, 0, 0)));
+    sectors.push_back(
+        {envelope, Sector, i, i, (-2.075 * M_PI / 32) + (i - 3) * (2 * M_PI / 32) + tweak_sectors[i]});
+  }
+
+  DetElement sector_det("sector0", det_id);
+  for (const auto& sector : sectors) {
+    PlacedVolume sect_phv = sector.mother.placeVolume(sector.daughter, sector.copy,
+                                                      Transform3D(RotationZ(sector.phi), Translation3D(0, 0, 0)));
     sect_phv.addPhysVolID("system", det_id);
     sect_phv.addPhysVolID("barrel", 0);
-    sect_phv.addPhysVolID("sector", i);
-    DetElement sd = sector_det.clone(_toString(i, "sector%d"));
+    sect_phv.addPhysVolID("sector", sector.id);
+    DetElement sd = sector_det.clone(_toString(sector.id, "sector%d"));
     sd.setPlacement(sect_phv);
     sdet.add(sd);
   }
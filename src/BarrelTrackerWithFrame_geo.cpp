@@ -68,7 +68,7 @@ static Ref_t create_BarrelTrackerWithFrame(Detector& description, xml_h e, Sensi
   // Add the volume boundary material if configured
   for (xml_coll_t bmat(x_det, _Unicode(boundary_material)); bmat; ++bmat) {
     xml_comp_t x_boundary_material = bmat;
-    DD4hepDetectorHelper::xmlToProtoSurfaceMaterial(x_boundary_material, params,
+    DD4hepDetectorHelper::xmlToProtoSurfaceMaterial(x_boundary_material, sdet, params,
                                          "boundary_material");
   }
 
@@ -227,6 +227,18 @@ static Ref_t create_BarrelTrackerWithFrame(Detector& description, xml_h e, Sensi
     }
   }
 
+  // the sensor parameters are the same for all modules: the first sensor owns them, the others share them,
+  // just like the measurement planes are shared by all sensors of a module type
+  dd4hep::rec::VariantParameters* sensor_params   = nullptr;
+  auto                            addSensorParams = [&sensor_params](DetElement& comp_de) {
+    if (sensor_params == nullptr) {
+      sensor_params = &DD4hepDetectorHelper::ensureExtension<dd4hep::rec::VariantParameters>(comp_de);
+      sensor_params->set<string>("axis_definitions", "XYZ");
+    } else {
+      DD4hepDetectorHelper::shareExtension(comp_de, *sensor_params);
+    }
+  };
+
   // now build the layers
   for (xml_coll_t li(x_det, _U(layer)); li; ++li) {
     xml_comp_t x_layer  = li;
@@ -252,9 +264,10 @@ static Ref_t create_BarrelTrackerWithFrame(Detector& description, xml_h e, Sensi
     double nz       = z_layout.nz();       // Number of modules to place in z.
     double z_dr     = z_layout.dr();       // Radial displacement parameter, of every other module.
 
-    Volume      module_env = volumes[m_nam];
-    DetElement  lay_elt(sdet, lay_nam, lay_id);
-    Placements& sensVols = sensitives[m_nam];
+    Volume                 module_env = volumes[m_nam];
+    DetElement             lay_elt(sdet, lay_nam, lay_id);
+    Placements&            sensVols  = sensitives[m_nam];
+    std::vector<VolPlane>& sensSurfs = volplane_surfaces[m_nam];
 
     // the local coordinate systems of modules in dd4hep and acts differ
     // see http://acts.web.cern.ch/ACTS/latest/doc/group__DD4hepPlugins.html
@@ -264,7 +277,8 @@ static Ref_t create_BarrelTrackerWithFrame(Detector& description, xml_h e, Sensi
 
     for (xml_coll_t lmat(x_layer, _Unicode(layer_material)); lmat; ++lmat) {
       xml_comp_t x_layer_material = lmat;
-      DD4hepDetectorHelper::xmlToProtoSurfaceMaterial(x_layer_material, layerParams, "layer_material");
+      DD4hepDetectorHelper::xmlToProtoSurfaceMaterial(x_layer_material, lay_elt, layerParams,
+                                                      "layer_material");
     }
 
     // Z increment for module placement along Z axis.
@@ -297,13 +311,12 @@ static Ref_t create_BarrelTrackerWithFrame(Detector& description, xml_h e, Sensi
           DetElement   comp_de(mod_elt, std::string("de_") + sens_pv.volume().name(), module);
           comp_de.setPlacement(sens_pv);
 
-          auto &params = DD4hepDetectorHelper::ensureExtension<dd4hep::rec::VariantParameters>(comp_de);
-          params.set<string>("axis_definitions", "XYZ");
+          addSensorParams(comp_de);
           // comp_de.setAttributes(description, sens_pv.volume(), x_layer.regionStr(), x_layer.limitsStr(),
           //                       xml_det_t(xmleles[m_nam]).visStr());
           //
 
-          volSurfaceList(comp_de)->push_back(volplane_surfaces[m_nam][ic]);
+          volSurfaceList(comp_de)->push_back(sensSurfs[ic]);
         }
 
         /// Increase counters etc.
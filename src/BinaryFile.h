@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 agent
+
+#pragma once
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* versioned binary files of the geometry builders and tools (mesh cache, sensor lookup tables)
+ *
+ * Every file starts with a 16-byte header: char magic[8], uint32 format version, uint32 byte order mark
+ * 0x01020304. The files are written in native byte order, so a reader on a host with a different byte
+ * order sees a different byte order mark and rejects the file. Header only, so that consumers outside of
+ * this repository can read the files without linking the geometry plugin.
+ */
+namespace epic::geo {
+
+  inline constexpr std::uint32_t binary_file_byteorder = 0x01020304;
+
+  struct BinaryFileHeader {
+    char          magic[8];
+    std::uint32_t version;
+    std::uint32_t byteorder;
+  };
+  static_assert(sizeof(BinaryFileHeader) == 16, "BinaryFileHeader must not be padded");
+
+  /// Header of a file with the given magic (at most 7 characters) and format version
+  inline BinaryFileHeader binaryFileHeader(const char* magic, std::uint32_t version)
+  {
+    BinaryFileHeader header{};
+    // the magic is always NUL terminated, longer magics are cut
+    std::memcpy(header.magic, magic, std::min<std::size_t>(std::strlen(magic), sizeof(header.magic) - 1));
+    header.version   = version;
+    header.byteorder = binary_file_byteorder;
+    return header;
+  }
+
+  /// True if the header has the given magic and format version, and the byte order of this host
+  inline bool checkBinaryFileHeader(const BinaryFileHeader& header, const char* magic, std::uint32_t version)
+  {
+    BinaryFileHeader expected = binaryFileHeader(magic, version);
+    return std::memcmp(&header, &expected, sizeof(header)) == 0;
+  }
+
+  /// Read a whole file into memory, returns false if it cannot be read
+  inline bool readFile(const std::string& path, std::string& buffer)
+  {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+      return false;
+    }
+    buffer.resize(static_cast<std::size_t>(in.tellg()));
+    in.seekg(0);
+    return static_cast<bool>(in.read(buffer.data(), buffer.size()));
+  }
+
+  /// Sequential reader over a buffer, every read fails once the buffer is exhausted
+  class BufferReader {
+  public:
+    explicit BufferReader(const std::string& buffer) : m_pos(buffer.data()), m_end(buffer.data() + buffer.size()) {}
+
+    bool read(void* dst, std::size_t size)
+    {
+      if (static_cast<std::size_t>(m_end - m_pos) < size) {
+        return false;
+      }
+      std::memcpy(dst, m_pos, size);
+      m_pos += size;
+      return true;
+    }
+
+    template <typename T> bool read(T& value) { return read(&value, sizeof(T)); }
+
+    /// Vector written by BufferWriter::write, a uint32 size followed by the elements
+    template <typename T> bool read(std::vector<T>& values)
+    {
+      std::uint32_t n = 0;
+      if (!read(n) || static_cast<std::size_t>(m_end - m_pos) / sizeof(T) < n) {
+        return false;
+      }
+      values.resize(n);
+      return read(values.data(), n * sizeof(T));
+    }
+
+    bool read(std::string& value)
+    {
+      std::uint32_t n = 0;
+      if (!read(n) || static_cast<std::size_t>(m_end - m_pos) < n) {
+        return false;
+      }
+      value.assign(m_pos, n);
+      m_pos += n;
+      return true;
+    }
+
+    /// Number of bytes not read yet
+    std::size_t remaining() const { return m_end - m_pos; }
+
+  private:
+    const char* m_pos;
+    const char* m_end;
+  };
+
+  /// Sequential writer into a buffer, the counterpart of BufferReader
+  class BufferWriter {
+  public:
+    void write(const void* src, std::size_t size) { m_buffer.append(static_cast<const char*>(src), size); }
+
+    template <typename T> void write(const T& value) { write(&value, sizeof(T)); }
+
+    template <typename T> void write(const std::vector<T>& values)
+    {
+      write(static_cast<std::uint32_t>(values.size()));
+      write(values.data(), values.size() * sizeof(T));
+    }
+
+    void write(const std::string& value)
+    {
+      write(static_cast<std::uint32_t>(value.size()));
+      write(value.data(), value.size());
+    }
+
+    const std::string& buffer() const { return m_buffer; }
+
+  private:
+    std::string m_buffer;
+  };
+
+  /** Write a file atomically, creating its directory if needed.
+   *
+   * The contents go to a uniquely named temporary file in the same directory, which is then renamed,
+   * so readers never see a partial file and concurrent writers do not interfere (the last rename wins).
+   * Returns false if the file cannot be written.
+   */
+  inline bool writeFileAtomic(const std::string& path, const std::string& contents)
+  {
+    namespace fs = std::filesystem;
+
+    fs::path        file_path(path);
+    std::error_code ec;
+    if (file_path.has_parent_path()) {
+      fs::create_directories(file_path.parent_path(), ec);
+    }
+
+    std::string tmp_path = path + ".XXXXXX";
+    int         fd       = ::mkstemp(tmp_path.data());
+    if (fd < 0) {
+      return false;
+    }
+    // mkstemp creates the file readable by its owner only
+    ::fchmod(fd, 0644);
+    bool ok = true;
+    for (std::size_t done = 0; ok && done < contents.size();) {
+      ssize_t n = ::write(fd, contents.data() + done, contents.size() - done);
+      if (n < 0 && errno == EINTR) {
+        continue;
+      }
+      ok = n > 0;
+      done += ok ? n : 0;
+    }
+    ok = (::close(fd) == 0) && ok;
+    if (ok) {
+      fs::rename(tmp_path, file_path, ec);
+      ok = !ec;
+    }
+    if (!ok) {
+      fs::remove(tmp_path, ec);
+    }
+    return ok;
+  }
+
+} // namespace epic::geo
@@ -36,7 +36,7 @@ static Ref_t create_element(Detector& description, xml_h e, Ref_t)
   // Add the volume boundary material if configured
   for (xml_coll_t bmat(x_det, _Unicode(boundary_material)); bmat; ++bmat) {
     xml_comp_t x_boundary_material = bmat;
-    DD4hepDetectorHelper::xmlToProtoSurfaceMaterial(x_boundary_material, params,
+    DD4hepDetectorHelper::xmlToProtoSurfaceMaterial(x_boundary_material, sdet, params,
                                          "boundary_material");
   }
 
@@ -4,9 +4,12 @@
 #pragma once
 
 #include <DD4hep/DetElement.h>
+#include <DD4hep/ExtensionEntry.h>
+#include <DD4hep/Printout.h>
 #include <DDRec/DetectorData.h>
-#include <boost/foreach.hpp>
-#include <boost/tokenizer.hpp>
+#include <array>
+#include <string>
+#include <string_view>
 
 #include "DD4hep/DetFactoryHelper.h"
 
@@ -18,37 +21,83 @@ T& ensureExtension(dd4hep::DetElement& elt) {
   T* ext = elt.extension<T>(false);
   if (ext == nullptr) {
     ext = new T();
+    elt.addExtension<T>(ext);
   }
-  elt.addExtension<T>(ext);
   return *ext;
 }
 
-inline void xmlToProtoSurfaceMaterial(const xml_comp_t& x_material,
+// Attach an extension object that is shared with other detector elements. The detector element
+// does not take ownership, the object must be owned elsewhere (e.g. by the first element using it).
+template <typename T>
+T& shareExtension(dd4hep::DetElement& elt, T& shared) {
+  elt.addExtension(new dd4hep::detail::SimpleExtension<T, T>(&shared));
+  return shared;
+}
+
+// Proto surface material of a layer or boundary, as declared by a <layer_material> or
+// <boundary_material> element, e.g.
+//   <layer_material surface="representing" binning="binPhi,binR" bins0="64" bins1="16"/>
+struct ProtoSurfaceMaterial {
+  std::string                tag;     // e.g. "layer_material_representing"
+  std::array<std::string, 2> binning; // e.g. {"binPhi", "binR"}
+  std::array<int, 2>         bins = {0, 0};
+};
+
+// Parse a <layer_material> or <boundary_material> element. Returns false if the binning does not
+// have exactly two non-empty comma-separated entries (empty entries are skipped, e.g. "binPhi,binZ,").
+inline bool parseProtoSurfaceMaterial(const xml_comp_t& x_material, const std::string& baseTag,
+                                      ProtoSurfaceMaterial& material) {
+  std::string      mBinning = x_material.attr<std::string>("binning");
+  std::string_view binning(mBinning);
+  std::size_t      n = 0;
+  while (!binning.empty()) {
+    auto             comma = binning.find(',');
+    std::string_view token = binning.substr(0, comma);
+    binning.remove_prefix(comma == std::string_view::npos ? binning.size() : comma + 1);
+    if (token.empty()) {
+      continue;
+    }
+    if (n == material.binning.size()) {
+      return false;
+    }
+    material.binning[n++] = std::string(token);
+  }
+  if (n != material.binning.size()) {
+    return false;
+  }
+  material.tag = baseTag;
+  material.tag += '_';
+  material.tag += x_material.attr<std::string>("surface");
+  material.bins = {x_material.attr<int>("bins0"), x_material.attr<int>("bins1")};
+  return true;
+}
+
+// Store a parsed proto surface material in the VariantParameters read by the ACTS conversion
+inline void setProtoSurfaceMaterial(dd4hep::rec::VariantParameters& params, const ProtoSurfaceMaterial& material) {
+  params.set<bool>(material.tag, true);
+  for (std::size_t i = 0; i < material.binning.size(); ++i) {
+    std::string key;
+    key.reserve(material.tag.size() + 1 + material.binning[i].size());
+    key.append(material.tag).append(1, '_').append(material.binning[i]);
+    params.set<int>(key, material.bins[i]);
+  }
+}
+
+// Add a <layer_material> or <boundary_material> element of a detector element to the VariantParameters read
+// by the ACTS conversion
+inline void xmlToProtoSurfaceMaterial(const xml_comp_t& x_material, dd4hep::DetElement& elt,
                                       dd4hep::rec::VariantParameters& params,
                                       const std::string& baseTag) {
-  using namespace std::string_literals;
-  using namespace dd4hep;
-
   // Add the layer material flag
   params.set(baseTag, true);
-  // prepare everything here
-  std::string mSurface = x_material.attr<std::string>("surface");
-  std::string mBinning = x_material.attr<std::string>("binning");
-  boost::char_separator<char> sep(",");
-  boost::tokenizer binTokens(mBinning, sep);
-  const auto n = std::distance(binTokens.begin(), binTokens.end());
-  if (n == 2) {
-    // Fill the bins
-    auto bin = binTokens.begin();
-    std::string bin0 = *(bin);
-    std::string bin1 = *(++bin);
-    size_t nBins0 = x_material.attr<int>("bins0");
-    size_t nBins1 = x_material.attr<int>("bins1");
-    // Add the material tags
-    std::string btmSurface = baseTag + "_"s + mSurface;
-    params.set<bool>(btmSurface, true);
-    params.set<int>(btmSurface + "_"s + bin0, nBins0);
-    params.set<int>(btmSurface + "_"s + bin1, nBins1);
+  // Fill the bins
+  ProtoSurfaceMaterial material;
+  if (parseProtoSurfaceMaterial(x_material, baseTag, material)) {
+    setProtoSurfaceMaterial(params, material);
+  } else {
+    dd4hep::printout(dd4hep::WARNING, "DD4hepDetectorHelper",
+                     "%s: %s binning \"%s\" does not have two entries, no proto surface material",
+                     elt.path().c_str(), baseTag.c_str(), x_material.attr<std::string>("binning").c_str());
   }
 }
 
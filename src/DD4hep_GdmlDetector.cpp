@@ -25,6 +25,8 @@
 #include "XML/DocumentHandler.h"
 #include "XML/Utilities.h"
 
+#include "GeometryFragment.h"
+
 // ROOT includes
 #include "TGDMLParse.h"
 #include "TGDMLWrite.h"
@@ -33,11 +35,82 @@
 #include "TInterpreter.h"
 #include "TUri.h"
 
+#include <filesystem>
+#include <map>
+#include <utility>
+
 using namespace std;
 using namespace dd4hep;
 
 #if ROOT_VERSION_CODE >= ROOT_VERSION(6, 13, 0)
 
+/// GDML files parsed for a detector description, and the attributes of the volumes attached from them
+/**
+ *  Attached to the Detector as an extension, so the cache lives and dies with its geometry manager.
+ */
+struct GdmlImportCache {
+  /// Attributes set on an attached volume, and the detector element which set them
+  struct Attributes {
+    string detector, vis, limits, region;
+  };
+  map<pair<string, filesystem::file_time_type>, Volume> volumes;
+  map<const TGeoVolume*, Attributes>                     attributes;
+};
+
+static GdmlImportCache& import_cache(Detector& description)
+{
+  auto* cache = description.extension<GdmlImportCache>(false);
+  if (cache == nullptr) {
+    cache = description.addExtension<GdmlImportCache>(new GdmlImportCache);
+  }
+  return *cache;
+}
+
+/// Parse a GDML file, or return the top volume of an earlier parse of the same file
+/**
+ *  Parsed files are cached per detector description by path and modification time, so detector
+ *  elements which import different physvols of the same file share a single parse.
+ *  A pre-converted ROOT file <gdml>.root (see epic_GdmlConverter) is read instead of the
+ *  GDML file when it is not older than the GDML file.
+ */
+static Volume read_gdml(Detector& description, const string& gdml, bool use_cache)
+{
+  auto& cache = import_cache(description).volumes;
+
+  error_code ec;
+  auto       mtime = filesystem::last_write_time(gdml, ec);
+  auto       key   = make_pair(gdml, mtime);
+  if (use_cache && !ec) {
+    auto it = cache.find(key);
+    if (it != cache.end()) {
+      printout(INFO, "ROOTGDMLParse", "+++ Reuse parsed GDML file %s", gdml.c_str());
+      return it->second;
+    }
+  }
+
+  // prefer the ROOT file written by the epic_GdmlConverter plugin when it is up to date
+  Volume volume;
+  if (epic::geo::hasFragment(gdml)) {
+    string fragment = epic::geo::fragmentPath(gdml);
+    volume          = epic::geo::readFragment(description, fragment);
+    if (volume.isValid()) {
+      printout(INFO, "ROOTGDMLParse", "+++ Read pre-converted GDML file %s", fragment.c_str());
+    }
+  }
+  if (!volume.isValid()) {
+    TGDMLParse parser;
+    volume = parser.GDMLReadFile(gdml.c_str());
+  }
+  if (!volume.isValid()) {
+    except("ROOTGDMLParse", "+++ Failed to parse GDML file:%s", gdml.c_str());
+  }
+  volume.import(); // We require the extensions in dd4hep.
+  if (use_cache && !ec) {
+    cache.emplace(key, volume);
+  }
+  return volume;
+}
+
 /// Factory to import subdetectors from GDML fragment
 static Ref_t create_detector(Detector& description, xml_h e, Ref_t /* sens_det */)
 {
@@ -52,8 +125,8 @@ static Ref_t create_detector(Detector& description, xml_h e, Ref_t /* sens_det *
   string     par_nam      = x_par.nameStr();
   string     gdml         = x_gdml.attr<string>(_U(ref));
   string     gdml_physvol = dd4hep::getAttrOrDefault<string>(x_gdml, _Unicode(physvol), "");
+  bool       gdml_cache   = dd4hep::getAttrOrDefault<bool>(x_gdml, _Unicode(cache), true);
   DetElement det_parent   = description.detector(par_nam);
-  TGDMLParse parser;
   if (!gdml.empty() && gdml[0] == '/') {
     TUri uri(gdml.c_str());
     gdml = uri.GetRelativePart();
@@ -66,11 +139,7 @@ static Ref_t create_detector(Detector& description, xml_h e, Ref_t /* sens_det *
     except(name, "+++ Cannot access detector parent: %s", par_nam.c_str());
   }
   DetElement sdet(name, id);
-  Volume     volume = parser.GDMLReadFile(gdml.c_str());
-  if (!volume.isValid()) {
-    except("ROOTGDMLParse", "+++ Failed to parse GDML file:%s", gdml.c_str());
-  }
-  volume.import(); // We require the extensions in dd4hep.
+  Volume     volume = read_gdml(description, gdml, gdml_cache);
   printout(INFO, "ROOTGDMLParse", "+++ Attach GDML volume %s", volume.name());
   Volume       mother = det_parent.volume();
   PlacedVolume pv;
@@ -99,9 +168,20 @@ static Ref_t create_detector(Detector& description, xml_h e, Ref_t /* sens_det *
   } else {
     pv = mother.placeVolume(volume);
   }
-  volume.setVisAttributes(description, x_det.visStr());
-  volume.setLimitSet(description, x_det.limitsStr());
-  volume.setRegion(description, x_det.regionStr());
+  // a volume from a cached parse may already be attached by another detector element, which keeps its attributes
+  GdmlImportCache::Attributes attributes{name, x_det.visStr(), x_det.limitsStr(), x_det.regionStr()};
+  auto [shared, inserted] = import_cache(description).attributes.emplace(volume.ptr(), attributes);
+  if (inserted) {
+    volume.setVisAttributes(description, attributes.vis);
+    volume.setLimitSet(description, attributes.limits);
+    volume.setRegion(description, attributes.region);
+  } else if (shared->second.vis != attributes.vis || shared->second.limits != attributes.limits ||
+             shared->second.region != attributes.region) {
+    printout(WARNING, "ROOTGDMLParse",
+             "+++ %s: volume %s is shared with %s, keeping its vis, limits and region (%s, %s, %s)", name.c_str(),
+             volume.name(), shared->second.detector.c_str(), shared->second.vis.c_str(),
+             shared->second.limits.c_str(), shared->second.region.c_str());
+  }
   if (id != 0) {
     pv.addPhysVolID("system", id);
   }
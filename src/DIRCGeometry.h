@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 agent
+
+#pragma once
+#include <DD4hep/DetElement.h>
+
+#include <cmath>
+
+// bar layout of the DIRC modules, attached as an extension to the DIRC DetElement
+namespace epic::geo {
+
+  /** Bar stack of a DIRC module, in DD4hep units.
+   *
+   * The bars are placed as one parameterised grid without per-bar volume IDs; the bar and section
+   * numbers follow from the y and z coordinates in the module frame instead, e.g.
+   *   auto* bars = desc.detector("DIRC").extension<epic::geo::DIRCBarGeometry>();
+   *   int   bar  = bars->bar(local.y());
+   */
+  struct DIRCBarGeometry {
+    DIRCBarGeometry()                       = default;
+    DIRCBarGeometry(const DIRCBarGeometry&) = default;
+    /// Copy for a cloned detector element, as required of DetElement extensions
+    DIRCBarGeometry(const DIRCBarGeometry& other, dd4hep::DetElement /* de */) : DIRCBarGeometry(other) {}
+
+    double bar_width      = 0;
+    double bar_gap        = 0; // gap between adjacent bars in y
+    double bar_length     = 0;
+    double glue_thickness = 0; // glue joint at the -z end of each bar
+    int    repeat_y       = 0;
+    int    repeat_z       = 0;
+
+    /// Bar number (starting at +y), or -1 in a gap or outside of the stack
+    int bar(double y) const
+    {
+      double pitch = bar_width + bar_gap;
+      double u     = 0.5 * (repeat_y * pitch - bar_gap) - y;
+      int    i     = static_cast<int>(std::floor(u / pitch));
+      return (i >= 0 && i < repeat_y && u - i * pitch <= bar_width) ? i : -1;
+    }
+
+    /// Section number (starting at +z) of a bar and its glue joint, or -1 outside of the stack
+    int section(double z) const
+    {
+      double pitch = bar_length + glue_thickness;
+      double u     = 0.5 * repeat_z * pitch - z;
+      int    i     = static_cast<int>(std::floor(u / pitch));
+      return (i >= 0 && i < repeat_z) ? i : -1;
+    }
+  };
+
+} // namespace epic::geo
@@ -8,6 +8,8 @@
 #include "DDRec/Surface.h"
 #include <XML/Helper.h>
 
+#include "DIRCGeometry.h"
+
 //////////////////////////////////
 // Central Barrel DIRC
 //////////////////////////////////
@@ -48,37 +50,51 @@ static Ref_t createDetector(Detector& desc, xml_h e, SensitiveDetector sens)
   Assembly dirc_module("DIRCModule");
   dirc_module.setVisAttributes(desc.visAttributes(xml_module.visStr()));
 
-  // Bar
-  xml_comp_t xml_bar    = xml_module.child(_Unicode(bar));
-  double     bar_height = xml_bar.height();
-  double     bar_width  = xml_bar.width();
-  double     bar_length = xml_bar.length();
-  Box        bar_box("bar_box", bar_height / 2, bar_width / 2, bar_length / 2);
-  Volume     bar_vol("bar_vol", bar_box, desc.material(xml_bar.materialStr()));
-  bar_vol.setVisAttributes(desc.visAttributes(xml_bar.visStr()));
-
-  // Glue
+  // Bar and glue
+  xml_comp_t xml_bar        = xml_module.child(_Unicode(bar));
+  double     bar_height     = xml_bar.height();
+  double     bar_width      = xml_bar.width();
+  double     bar_length     = xml_bar.length();
   xml_comp_t xml_glue       = xml_module.child(_Unicode(glue));
   double     glue_thickness = xml_glue.thickness();
-  Box        glue_box("glue_box", bar_height / 2, bar_width / 2, glue_thickness / 2);
-  Volume     glue_vol("glue_vol", glue_box, desc.material(xml_glue.materialStr()));
+
+  // the bar volume includes its glue joint at -z, so the bar faces are boundaries with the medium
+  // and only the glue joint is a daughter
+  Box    bar_box("bar_box", bar_height / 2, bar_width / 2, (bar_length + glue_thickness) / 2);
+  Volume bar_vol("bar_vol", bar_box, desc.material(xml_bar.materialStr()));
+  bar_vol.setVisAttributes(desc.visAttributes(xml_bar.visStr()));
+  Box    glue_box("glue_box", bar_height / 2, bar_width / 2, glue_thickness / 2);
+  Volume glue_vol("glue_vol", glue_box, desc.material(xml_glue.materialStr()));
   glue_vol.setVisAttributes(desc.visAttributes(xml_glue.visStr()));
+  bar_vol.placeVolume(glue_vol, Position(0, 0, -0.5 * bar_length));
 
-  // Place bars + glue into module assembly
-  // FIXME place bars + glue into separate box volume
+  // Bar stack: the bars are placed as one parameterised grid in a box, instead of one bar and one glue
+  // placement per bar in the module; the bar and section numbers follow from the position in the
+  // module (see DIRCGeometry.h)
   auto bar_repeat_y    = xml_bar.attr<int>(_Unicode(repeat_y));
   auto bar_repeat_z    = xml_bar.attr<int>(_Unicode(repeat_z));
   auto bar_gap         = xml_bar.gap();
   auto bar_assm_width  = (bar_width + bar_gap) * bar_repeat_y - bar_gap;
   auto bar_assm_length = (bar_length + glue_thickness) * bar_repeat_z;
-  for (int y_index = 0; y_index < bar_repeat_y; y_index++) {
-    double y = 0.5 * bar_assm_width - 0.5 * bar_width - (bar_width + bar_gap) * y_index;
-    for (int z_index = 0; z_index < bar_repeat_z; z_index++) {
-      double z = 0.5 * bar_assm_length - 0.5 * bar_length - (bar_length + glue_thickness) * z_index;
-      dirc_module.placeVolume(glue_vol, Position(0, y, z - 0.5 * (bar_length + glue_thickness)));
-      dirc_module.placeVolume(bar_vol, Position(0, y, z)).addPhysVolID("section", z_index).addPhysVolID("bar", y_index);
-    }
-  }
+
+  // the gaps between the bars keep the medium around the module
+  Box    bar_stack_box("bar_stack_box", bar_height / 2, bar_assm_width / 2, bar_assm_length / 2);
+  Volume bar_stack_vol("bar_stack_vol", bar_stack_box, desc.pickMotherVolume(det).material());
+  bar_stack_vol.setVisAttributes(desc.visAttributes("InvisibleWithDaughters"));
+  bar_stack_vol.paramVolume2D(Transform3D(Position(0, 0.5 * (bar_assm_width - bar_width),
+                                                   0.5 * (bar_assm_length - bar_length - glue_thickness))),
+                              bar_repeat_y, bar_vol, Position(0, -(bar_width + bar_gap), 0), bar_repeat_z,
+                              Position(0, 0, -(bar_length + glue_thickness)));
+  dirc_module.placeVolume(bar_stack_vol, Position(0, 0, 0));
+
+  auto* bar_geometry           = new epic::geo::DIRCBarGeometry;
+  bar_geometry->bar_width      = bar_width;
+  bar_geometry->bar_gap        = bar_gap;
+  bar_geometry->bar_length     = bar_length;
+  bar_geometry->glue_thickness = glue_thickness;
+  bar_geometry->repeat_y       = bar_repeat_y;
+  bar_geometry->repeat_z       = bar_repeat_z;
+  det.addExtension<epic::geo::DIRCBarGeometry>(bar_geometry);
 
   // Mirror construction
   xml_comp_t xml_mirror       = xml_module.child(_Unicode(mirror));
@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 agent
+
+#include "DRICHOptics.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace epic::geo {
+
+  namespace {
+
+    // point or direction in the sector plane
+    struct Vec2 {
+      double x, z;
+    };
+    Vec2   operator+(Vec2 a, Vec2 b) { return {a.x + b.x, a.z + b.z}; }
+    Vec2   operator-(Vec2 a, Vec2 b) { return {a.x - b.x, a.z - b.z}; }
+    Vec2   operator*(double s, Vec2 a) { return {s * a.x, s * a.z}; }
+    double dot(Vec2 a, Vec2 b) { return a.x * b.x + a.z * b.z; }
+    double norm(Vec2 a) { return std::sqrt(dot(a, a)); }
+
+    // distance along the ray (p,d) to the circle (c,r): the far intersection (concave mirror, seen from
+    // inside), or the nearest one in front of p; false if there is none
+    bool intersect(Vec2 p, Vec2 d, Vec2 c, double r, bool far, double& t)
+    {
+      Vec2   pc   = p - c;
+      double b    = dot(pc, d);
+      double disc = b * b - (dot(pc, pc) - r * r);
+      if (disc < 0) {
+        return false;
+      }
+      double s = std::sqrt(disc);
+      t        = (far || -b - s <= 0) ? -b + s : -b - s;
+      return t > 0;
+    }
+
+  } // namespace
+
+  DRICHMirror drichMirror(const DRICHOpticsParameters& p)
+  {
+    // - sensor sphere center, w.r.t. IP
+    double zS = p.sensor_centerz + p.zmin;
+    double xS = p.sensor_centerx;
+    // - distance between IP and mirror back plane
+    double b = p.zmin + p.length - p.backplane;
+    // - desired focal region: sensor sphere center, offset by focus-tune (z,x) parameters
+    double zF = zS + p.focus_tune_z;
+    double xF = xS + p.focus_tune_x;
+
+    // determine the mirror that focuses the IP to this desired region
+    /* - uses point-to-point focusing to derive spherical mirror center
+     *   `(mirrorCenterZ,mirrorCenterX)` and radius `mirrorRadius` for given
+     *   image point coordinates `(zF,xF)` and `b`, defined as the z-distance
+     *   between the object (IP) and the mirror surface
+     * - all coordinates are specified w.r.t. the object point (IP)
+     */
+    DRICHMirror m;
+    m.center_z = b * zF / (2 * b - zF);
+    m.center_x = b * xF / (2 * b - zF);
+    m.radius   = b - m.center_z;
+
+    // spherical mirror patch cuts and rotation
+    m.theta_rot = std::asin(m.center_x / m.radius);
+    m.theta1    = m.theta_rot - std::asin((m.center_x - p.rmin) / m.radius);
+    m.theta2    = m.theta_rot + std::asin((p.rmax - m.center_x) / m.radius);
+    return m;
+  }
+
+  std::vector<DRICHImage> drichImages(const DRICHOpticsParameters& p, const std::vector<double>& thetas,
+                                      double cherenkov_angle, int emission_points)
+  {
+    const auto   mirror = drichMirror(p);
+    const Vec2   C{mirror.center_x, mirror.center_z};
+    const Vec2   S{p.sensor_centerx, p.sensor_centerz + p.zmin};
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+
+    std::vector<DRICHImage> images;
+    images.reserve(thetas.size());
+    for (double theta : thetas) {
+      auto& image = images.emplace_back();
+      image.theta = theta;
+
+      // the photons are emitted between the vessel front plane and the mirror
+      const Vec2 track{std::sin(theta), std::cos(theta)};
+      double     s0 = p.zmin / track.z, s1 = 0;
+      if (emission_points < 2 || !intersect({0, 0}, track, C, mirror.radius, true, s1) || s1 <= s0) {
+        continue;
+      }
+
+      bool   accepted = true;
+      Vec2   side_mean[2] = {};
+      double variance = 0, focus_distance = 0;
+      for (int side = 0; side < 2 && accepted; ++side) {
+        double     angle = theta + (side == 0 ? -cherenkov_angle : cherenkov_angle);
+        const Vec2 d{std::sin(angle), std::cos(angle)};
+
+        // reflected rays and their hits; the focus is the least squares intersection of the reflected rays
+        Vec2   sum{0, 0};
+        double sum2 = 0;
+        double a_xx = 0, a_xz = 0, a_zz = 0, b_x = 0, b_z = 0;
+        for (int k = 0; k < emission_points; ++k) {
+          Vec2   e = (s0 + (k + 0.5) / emission_points * (s1 - s0)) * track;
+          double t = 0;
+          if (!intersect(e, d, C, mirror.radius, true, t)) {
+            accepted = false;
+            break;
+          }
+          Vec2 m = e + t * d;
+          if (m.x < p.rmin || m.x > p.rmax) {
+            accepted = false;
+            break;
+          }
+          Vec2 n = (1 / mirror.radius) * (m - C);
+          Vec2 r = d - 2 * dot(d, n) * n;
+          if (!intersect(m, r, S, p.sensor_radius, false, t)) {
+            accepted = false;
+            break;
+          }
+          Vec2 h = m + t * r;
+          sum    = sum + h;
+          sum2 += dot(h, h);
+          // projector onto the normal of the reflected ray
+          double pxx = 1 - r.x * r.x, pxz = -r.x * r.z, pzz = 1 - r.z * r.z;
+          a_xx += pxx;
+          a_xz += pxz;
+          a_zz += pzz;
+          b_x += pxx * m.x + pxz * m.z;
+          b_z += pxz * m.x + pzz * m.z;
+        }
+        if (!accepted) {
+          break;
+        }
+        side_mean[side] = (1.0 / emission_points) * sum;
+        variance += sum2 / emission_points - dot(side_mean[side], side_mean[side]);
+        double det = a_xx * a_zz - a_xz * a_xz;
+        if (std::abs(det) > 1e-12 * (a_xx * a_zz)) {
+          Vec2 focus{(a_zz * b_x - a_xz * b_z) / det, (a_xx * b_z - a_xz * b_x) / det};
+          focus_distance += norm(focus - S) - p.sensor_radius;
+        } else {
+          focus_distance = nan; // parallel reflected rays
+        }
+      }
+      if (!accepted) {
+        continue;
+      }
+
+      Vec2 center          = 0.5 * (side_mean[0] + side_mean[1]);
+      image.accepted       = true;
+      image.x              = center.x;
+      image.z              = center.z;
+      image.ring_radius    = 0.5 * norm(side_mean[1] - side_mean[0]);
+      image.blur           = std::sqrt(std::max(0.0, variance / 2));
+      image.focus_distance = focus_distance / 2;
+    }
+    return images;
+  }
+
+} // namespace epic::geo
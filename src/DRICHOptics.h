@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 agent
+
+#pragma once
+#include <vector>
+
+/* analytic model of the dRICH optics of one sector, in the plane of the sector (x,z)
+ *
+ * The mirror is derived with the same point-to-point focusing equations as the geometry, and photons
+ * are traced in the sector plane, so that the optics can be scanned without building the detector.
+ * The model does not depend on DD4hep; lengths are in any consistent unit (the compact files use cm),
+ * angles in rad.
+ */
+namespace epic::geo {
+
+  /// Optics parameters, named after the attributes of the dRICH compact file
+  struct DRICHOpticsParameters {
+    double zmin;           // vessel front plane, w.r.t. the IP
+    double length;         // vessel length
+    double backplane;      // mirror back plane, w.r.t. the vessel back plane
+    double rmin;           // mirror inner radius
+    double rmax;           // mirror outer radius
+    double focus_tune_z;   // focal region, w.r.t. the sensor sphere center
+    double focus_tune_x;
+    double sensor_centerx; // sensor sphere center, w.r.t. the vessel front plane
+    double sensor_centerz;
+    double sensor_radius;  // sensor sphere radius
+  };
+
+  /// Spherical mirror of one sector, w.r.t. the IP
+  struct DRICHMirror {
+    double center_x;
+    double center_z;
+    double radius;
+    double theta_rot; // rotation of the mirror patch about the vertical axis
+    double theta1;    // polar angle limits of the mirror patch, w.r.t. the rotated sphere
+    double theta2;
+  };
+
+  /// Image on the sensor sphere of the Cherenkov photons of a track from the IP
+  struct DRICHImage {
+    double theta          = 0;     // polar angle of the track, in the sector plane
+    bool   accepted       = false; // all photons are reflected by the mirror patch and reach the sensor sphere
+    double x              = 0;     // ring center on the sensor sphere
+    double z              = 0;
+    double ring_radius    = 0;     // distance from the ring center to the hits of each ring side
+    double blur           = 0;     // RMS spread of the hits of photons emitted along the track
+    double focus_distance = 0;     // distance from the sensor sphere to the focus of each ring side, positive outside
+  };
+
+  /// Mirror focusing the IP onto the sensor sphere center, offset by the focus tune parameters
+  DRICHMirror drichMirror(const DRICHOpticsParameters& p);
+
+  /** Images of tracks from the IP with polar angles `thetas`.
+   *
+   * For each track, the photons of the two ring sides in the sector plane are emitted at `emission_points`
+   * (at least 2) points along the track, between the vessel front plane and the mirror.
+   */
+  std::vector<DRICHImage> drichImages(const DRICHOpticsParameters& p, const std::vector<double>& thetas,
+                                      double cherenkov_angle, int emission_points);
+
+} // namespace epic::geo
@@ -20,9 +20,128 @@
 
 #include <XML/Helper.h>
 
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "DRICHOptics.h"
+#include "RICHGeometry.h"
+
 using namespace dd4hep;
 using namespace dd4hep::rec;
 
+// parameters of the sensor tiling on the spherical sensor surface, all sectors share one tiling
+struct SensorTiling {
+  double radius; // sphere radius
+  double pitch;  // sensor side + gap
+  double centerX, centerZ;
+  double patchPhiw, patchRmin, patchRmax, patchZmin;
+  bool   patchPhiOnly; // only apply the phi cut (debugging)
+
+  bool operator<(const SensorTiling& o) const
+  {
+    return std::tie(radius, pitch, centerX, centerZ, patchPhiw, patchRmin, patchRmax, patchZmin, patchPhiOnly) <
+           std::tie(o.radius, o.pitch, o.centerX, o.centerZ, o.patchPhiw, o.patchRmin, o.patchRmax, o.patchZmin,
+                    o.patchPhiOnly);
+  }
+};
+
+// ordered sensor positions (thetaGen, phiGen) on the generator sphere which pass the patch cuts
+/* ALGORITHM: generate sphere of positions
+ * - NOTE: there are two coordinate systems here:
+ *   - "global" the main EPIC coordinate system
+ *   - "generator" (vars end in `Gen`) is a local coordinate system for
+ *     generating points on a sphere; it is related to the global system by
+ *     a rotation; we do this so the "patch" (subset of generated
+ *     positions) of sensors we choose to build is near the equator, where
+ *     point distribution is more uniform
+ * - PROCEDURE: loop over `thetaGen`, with subloop over `phiGen`, each divided evenly
+ *   - the number of points to generate depends how many sensors (+`sensorGap`)
+ *     can fit within each ring of constant `thetaGen` or `phiGen`
+ *   - we divide the relevant circumference by the sensor
+ *     size(+`sensorGap`), and this number is allowed to be a fraction,
+ *     because likely we don't care about generating a full sphere and
+ *     don't mind a "seam" at the overlap point
+ *   - if we pick a patch of the sphere near the equator, and not near
+ *     the poles or seam, the sensor distribution will appear uniform
+ * - the patch cut `zCheck > patchZmin` bounds sin(thetaGen) and sin(phiGen) from below, so only
+ *   the band of (thetaGen, phiGen) that can intersect the patch is scanned; the exact cuts are
+ *   still applied, so the result and the module numbering do not depend on this restriction
+ * - the tiling is cached, so repeated constructions (e.g. parameter scans) with the same sensor
+ *   sphere and patch reuse it
+ */
+static const std::vector<std::pair<double, double>>& sensor_tiles(const SensorTiling& tiling)
+{
+  static std::map<SensorTiling, std::vector<std::pair<double, double>>> cache;
+  auto [it, inserted] = cache.try_emplace(tiling);
+  auto& tiles         = it->second;
+  if (!inserted) {
+    return tiles;
+  }
+
+  const double radius = tiling.radius;
+  // lower bound on sin(thetaGen) * sin(phiGen) = z / radius from the patch cut, -1 for no bound
+  const double sinMin = tiling.patchPhiOnly ? -1 : (tiling.patchZmin - tiling.centerZ) / radius;
+
+  // thetaGen loop: iterate less than "0.5 circumference / sensor size" times
+  double nTheta = M_PI * radius / tiling.pitch;
+  int    tBegin = 0, tEnd = (int)(nTheta + 0.5);
+  if (sinMin >= 1) {
+    tEnd = 0;
+  } else if (sinMin > 0) {
+    // sin(thetaGen) > sinMin, with one step of margin for rounding
+    tBegin = std::max(tBegin, (int)std::floor(std::asin(sinMin) / M_PI * nTheta) - 1);
+    tEnd   = std::min(tEnd, (int)std::ceil((M_PI - std::asin(sinMin)) / M_PI * nTheta) + 1);
+  }
+  for (int t = tBegin; t < tEnd; t++) {
+    double thetaGen = t / ((double)nTheta) * M_PI;
+
+    // phiGen loop: iterate less than "circumference at this latitude / sensor size" times
+    double nPhi   = 2 * M_PI * radius * std::sin(thetaGen) / tiling.pitch;
+    int    pBegin = 0, pEnd = (int)(nPhi + 0.5);
+    double sinPhiMin = std::sin(thetaGen) > 0 ? sinMin / std::sin(thetaGen) : (sinMin > 0 ? 1 : -1);
+    if (sinPhiMin >= 1) {
+      pEnd = 0;
+    } else if (sinPhiMin > 0) {
+      // sin(phiGen) > sinPhiMin, i.e. phiGen in (asin, pi - asin), with one step of margin for rounding
+      pBegin = std::max(pBegin, (int)std::floor((std::asin(sinPhiMin) + M_PI) / (2 * M_PI) * nPhi) - 1);
+      pEnd   = std::min(pEnd, (int)std::ceil((2 * M_PI - std::asin(sinPhiMin)) / (2 * M_PI) * nPhi) + 1);
+    }
+    for (int p = pBegin; p < pEnd; p++) {
+      double phiGen = p / ((double)nPhi) * 2 * M_PI - M_PI; // shift to [-pi,pi]
+
+      // determine global phi and theta
+      // - convert {radius,thetaGen,phiGen} -> {xGen,yGen,zGen}
+      double xGen = radius * std::sin(thetaGen) * std::cos(phiGen);
+      double yGen = radius * std::sin(thetaGen) * std::sin(phiGen);
+      double zGen = radius * std::cos(thetaGen);
+      // - convert {xGen,yGen,zGen} -> global {x,y,z} via rotation
+      double x = zGen;
+      double y = xGen;
+      double z = yGen;
+
+      // shift global coordinates so we can apply spherical patch cuts
+      double zCheck   = z + tiling.centerZ;
+      double xCheck   = x + tiling.centerX;
+      double yCheck   = y;
+      double rCheck   = std::hypot(xCheck, yCheck);
+      double phiCheck = std::atan2(yCheck, xCheck);
+
+      // patch cut
+      bool patchCut = std::fabs(phiCheck) < tiling.patchPhiw && zCheck > tiling.patchZmin &&
+                      rCheck > tiling.patchRmin && rCheck < tiling.patchRmax;
+      if (tiling.patchPhiOnly)
+        patchCut = std::fabs(phiCheck) < tiling.patchPhiw;
+      if (patchCut)
+        tiles.emplace_back(thetaGen, phiGen);
+    }
+  }
+  return tiles;
+}
+
 // create the detector
 static Ref_t createDetector(Detector& desc, xml::Handle_t handle, SensitiveDetector sens)
 {
@@ -143,6 +262,10 @@ static Ref_t createDetector(Detector& desc, xml::Handle_t handle, SensitiveDetec
   for (const auto& idField : sensorIDfields)
     cellMask |= readoutCoder[idField].mask();
   desc.add(Constant("DRICH_cell_mask", std::to_string(cellMask)));
+  // typed reconstruction parameters, alongside the string constants
+  auto* richGeo = new epic::geo::RICHGeometry();
+  det.addExtension<epic::geo::RICHGeometry>(richGeo);
+  richGeo->cell_mask = cellMask;
   // create a unique sensor ID from a sensor's PlacedVolume::volIDs
   auto encodeSensorID = [&readoutCoder](auto ids) {
     uint64_t enc = 0;
@@ -162,7 +285,6 @@ static Ref_t createDetector(Detector& desc, xml::Handle_t handle, SensitiveDetec
 
   // derived attributes
   double tankLength = vesselLength - snoutLength;
-  double vesselZmax = vesselZmin + vesselLength;
 
   // snout solids
   double boreDelta  = vesselRmin1 - vesselRmin0;
@@ -301,6 +423,9 @@ static Ref_t createDetector(Detector& desc, xml::Handle_t handle, SensitiveDetec
     desc.add(Constant("DRICH_aerogel_zpos", std::to_string(aerogelZpos)));
     desc.add(Constant("DRICH_airgap_zpos", std::to_string(airgapZpos)));
     desc.add(Constant("DRICH_filter_zpos", std::to_string(filterZpos)));
+    richGeo->aerogel.zpos = aerogelZpos;
+    richGeo->airgap.zpos  = airgapZpos;
+    richGeo->filter.zpos  = filterZpos;
   }
 
   // radiator material names
@@ -308,6 +433,10 @@ static Ref_t createDetector(Detector& desc, xml::Handle_t handle, SensitiveDetec
   desc.add(Constant("DRICH_airgap_material", airgapMat.ptr()->GetName(), "string"));
   desc.add(Constant("DRICH_filter_material", filterMat.ptr()->GetName(), "string"));
   desc.add(Constant("DRICH_gasvol_material", gasvolMat.ptr()->GetName(), "string"));
+  richGeo->aerogel.material = aerogelMat.ptr()->GetName();
+  richGeo->airgap.material  = airgapMat.ptr()->GetName();
+  richGeo->filter.material  = filterMat.ptr()->GetName();
+  richGeo->gasvol_material  = gasvolMat.ptr()->GetName();
 
   // SECTOR LOOP //////////////////////////////////////////////////////////////////////
 
@@ -318,6 +447,41 @@ static Ref_t createDetector(Detector& desc, xml::Handle_t handle, SensitiveDetec
   // double sensorCentroidZ = 0;
   // int    sensorCount     = 0;
 
+  // if debugging sphere properties, restrict number of sensors drawn
+  if (debugSensors) {
+    sensorSide = 2 * M_PI * sensorSphRadius / 64;
+  }
+
+  // sensor tiling on the sphere, w.r.t. the sphere reference position; computed once for all sectors
+  const auto& sensorTiles = sensor_tiles({sensorSphRadius, sensorSide + sensorGap, sensorSphCenterX, sensorSphCenterZ,
+                                          sensorSphPatchPhiw, sensorSphPatchRmin, sensorSphPatchRmax,
+                                          sensorSphPatchZmin, debugSensors});
+  std::vector<Transform3D> sensorTilePlacements;
+  sensorTilePlacements.reserve(sensorTiles.size());
+  for (const auto& [thetaGen, phiGen] : sensorTiles) {
+    // placement on the sphere (note: transformations are in reverse order)
+    // - transformations operate on global coordinates; the corresponding
+    //   generator coordinates are provided in the comments
+    sensorTilePlacements.push_back(
+        Transform3D(RotationX(phiGen)) *               // rotate about `zGen`
+        RotationZ(thetaGen) *                          // rotate about `yGen`
+        Translation3D(-sensorThickness / 2.0, 0., 0.) * // pull back so sensor active surface is at spherical surface
+        Translation3D(sensorSphRadius, 0., 0.) *       // push radially to spherical surface
+        RotationY(M_PI / 2) *                          // rotate sensor to be compatible with generator coords
+        RotationZ(-M_PI / 2));                         // correction for readout segmentation mapping
+  }
+
+  // spherical mirror, from the point-to-point focusing equations shared with the optics scan tool
+  epic::geo::DRICHOpticsParameters optics{vesselZmin,       vesselLength,     mirrorBackplane, mirrorRmin,
+                                          mirrorRmax,       focusTuneZ,       focusTuneX,      sensorSphCenterX,
+                                          sensorSphCenterZ, sensorSphRadius};
+  const auto mirror = epic::geo::drichMirror(optics);
+  printout(DEBUG, "DRICH_geo",
+           "optics: zmin=%g length=%g backplane=%g rmin=%g rmax=%g focus_tune_z=%g focus_tune_x=%g "
+           "centerx=%g centerz=%g radius=%g",
+           vesselZmin, vesselLength, mirrorBackplane, mirrorRmin, mirrorRmax, focusTuneZ, focusTuneX,
+           sensorSphCenterX, sensorSphCenterZ, sensorSphRadius);
+
   for (int isec = 0; isec < nSectors; isec++) {
 
     // debugging filters, limiting the number of sectors
@@ -334,30 +498,14 @@ static Ref_t createDetector(Detector& desc, xml::Handle_t handle, SensitiveDetec
     // - sensor sphere center, w.r.t. IP
     double zS = sensorSphCenterZ + vesselZmin;
     double xS = sensorSphCenterX;
-    // - distance between IP and mirror back plane
-    double b = vesselZmax - mirrorBackplane;
-    // - desired focal region: sensor sphere center, offset by focus-tune (z,x) parameters
-    double zF = zS + focusTuneZ;
-    double xF = xS + focusTuneX;
-
-    // determine the mirror that focuses the IP to this desired region
-    /* - uses point-to-point focusing to derive spherical mirror center
-     *   `(mirrorCenterZ,mirrorCenterX)` and radius `mirrorRadius` for given
-     *   image point coordinates `(zF,xF)` and `b`, defined as the z-distance
-     *   between the object (IP) and the mirror surface
-     * - all coordinates are specified w.r.t. the object point (IP)
-     */
-    double mirrorCenterZ = b * zF / (2 * b - zF);
-    double mirrorCenterX = b * xF / (2 * b - zF);
-    double mirrorRadius  = b - mirrorCenterZ;
-
-    // translate mirror center to be w.r.t vessel front plane
-    mirrorCenterZ -= vesselZmin;
-
-    // spherical mirror patch cuts and rotation
-    double mirrorThetaRot = std::asin(mirrorCenterX / mirrorRadius);
-    double mirrorTheta1   = mirrorThetaRot - std::asin((mirrorCenterX - mirrorRmin) / mirrorRadius);
-    double mirrorTheta2   = mirrorThetaRot + std::asin((mirrorRmax - mirrorCenterX) / mirrorRadius);
+
+    // mirror that focuses the IP to the sensor sphere center, offset by the focus-tune parameters
+    double mirrorCenterZ  = mirror.center_z - vesselZmin; // w.r.t vessel front plane
+    double mirrorCenterX  = mirror.center_x;
+    double mirrorRadius   = mirror.radius;
+    double mirrorThetaRot = mirror.theta_rot;
+    double mirrorTheta1   = mirror.theta1;
+    double mirrorTheta2   = mirror.theta2;
 
     // if debugging, draw full sphere
     if (debugMirror) {
@@ -402,14 +550,11 @@ static Ref_t createDetector(Detector& desc, xml::Handle_t handle, SensitiveDetec
     desc.add(Constant("DRICH_mirror_center_z_" + secName, std::to_string(mirrorFinalCenter.z())));
     if (isec == 0)
       desc.add(Constant("DRICH_mirror_radius", std::to_string(mirrorRadius)));
+    auto& richSector  = richGeo->sectors.emplace_back();
+    richSector.mirror = {{mirrorFinalCenter.x(), mirrorFinalCenter.y(), mirrorFinalCenter.z()}, mirrorRadius};
 
     // BUILD SENSORS ====================================================================
 
-    // if debugging sphere properties, restrict number of sensors drawn
-    if (debugSensors) {
-      sensorSide = 2 * M_PI * sensorSphRadius / 64;
-    }
-
     // solid and volume: single sensor module
     Box    sensorSolid(sensorSide / 2., sensorSide / 2., sensorThickness / 2.);
     Volume sensorVol(detName + "_sensor_" + secName, sensorSolid, sensorMat);
@@ -428,110 +573,41 @@ static Ref_t createDetector(Detector& desc, xml::Handle_t handle, SensitiveDetec
     desc.add(Constant("DRICH_sensor_sph_center_z_" + secName, std::to_string(sensorSphFinalCenter.z())));
     if (isec == 0)
       desc.add(Constant("DRICH_sensor_sph_radius", std::to_string(sensorSphRadius)));
+    richSector.sensors = {{sensorSphFinalCenter.x(), sensorSphFinalCenter.y(), sensorSphFinalCenter.z()},
+                          sensorSphRadius};
 
     // SENSOR MODULE LOOP ------------------------
-    /* ALGORITHM: generate sphere of positions
-     * - NOTE: there are two coordinate systems here:
-     *   - "global" the main EPIC coordinate system
-     *   - "generator" (vars end in `Gen`) is a local coordinate system for
-     *     generating points on a sphere; it is related to the global system by
-     *     a rotation; we do this so the "patch" (subset of generated
-     *     positions) of sensors we choose to build is near the equator, where
-     *     point distribution is more uniform
-     * - PROCEDURE: loop over `thetaGen`, with subloop over `phiGen`, each divided evenly
-     *   - the number of points to generate depends how many sensors (+`sensorGap`)
-     *     can fit within each ring of constant `thetaGen` or `phiGen`
-     *   - we divide the relevant circumference by the sensor
-     *     size(+`sensorGap`), and this number is allowed to be a fraction,
-     *     because likely we don't care about generating a full sphere and
-     *     don't mind a "seam" at the overlap point
-     *   - if we pick a patch of the sphere near the equator, and not near
-     *     the poles or seam, the sensor distribution will appear uniform
-     */
-
     // initialize module number for this sector
     int imod = 0;
 
-    // thetaGen loop: iterate less than "0.5 circumference / sensor size" times
-    double nTheta = M_PI * sensorSphRadius / (sensorSide + sensorGap);
-    for (int t = 0; t < (int)(nTheta + 0.5); t++) {
-      double thetaGen = t / ((double)nTheta) * M_PI;
-
-      // phiGen loop: iterate less than "circumference at this latitude / sensor size" times
-      double nPhi = 2 * M_PI * sensorSphRadius * std::sin(thetaGen) / (sensorSide + sensorGap);
-      for (int p = 0; p < (int)(nPhi + 0.5); p++) {
-        double phiGen = p / ((double)nPhi) * 2 * M_PI - M_PI; // shift to [-pi,pi]
-
-        // determine global phi and theta
-        // - convert {radius,thetaGen,phiGen} -> {xGen,yGen,zGen}
-        double xGen = sensorSphRadius * std::sin(thetaGen) * std::cos(phiGen);
-        double yGen = sensorSphRadius * std::sin(thetaGen) * std::sin(phiGen);
-        double zGen = sensorSphRadius * std::cos(thetaGen);
-        // - convert {xGen,yGen,zGen} -> global {x,y,z} via rotation
-        double x = zGen;
-        double y = xGen;
-        double z = yGen;
-        // - convert global {x,y,z} -> global {phi,theta}
-        // double phi   = std::atan2(y, x);
-        // double theta = std::acos(z / sensorSphRadius);
-
-        // shift global coordinates so we can apply spherical patch cuts
-        double zCheck   = z + sensorSphCenterZ;
-        double xCheck   = x + sensorSphCenterX;
-        double yCheck   = y;
-        double rCheck   = std::hypot(xCheck, yCheck);
-        double phiCheck = std::atan2(yCheck, xCheck);
-
-        // patch cut
-        bool patchCut = std::fabs(phiCheck) < sensorSphPatchPhiw && zCheck > sensorSphPatchZmin &&
-                        rCheck > sensorSphPatchRmin && rCheck < sensorSphPatchRmax;
-        if (debugSensors)
-          patchCut = std::fabs(phiCheck) < sensorSphPatchPhiw;
-        if (patchCut) {
-
-          // append sensor position to centroid calculation
-          // if (isec == 0) {
-          //   sensorCentroidX += xCheck;
-          //   sensorCentroidZ += zCheck;
-          //   sensorCount++;
-          // }
-
-          // placement (note: transformations are in reverse order)
-          // - transformations operate on global coordinates; the corresponding
-          //   generator coordinates are provided in the comments
-          auto sensorPlacement =
-              sectorRotation *                                                      // rotate about beam axis to sector
-              Translation3D(sensorSphPos.x(), sensorSphPos.y(), sensorSphPos.z()) * // move sphere to reference position
-              RotationX(phiGen) *                                                   // rotate about `zGen`
-              RotationZ(thetaGen) *                                                 // rotate about `yGen`
-              Translation3D(-sensorThickness / 2.0, 0.,
-                            0.) *                      // pull back so sensor active surface is at spherical surface
-              Translation3D(sensorSphRadius, 0., 0.) * // push radially to spherical surface
-              RotationY(M_PI / 2) *                    // rotate sensor to be compatible with generator coords
-              RotationZ(-M_PI / 2);                    // correction for readout segmentation mapping
-          auto sensorPV = gasvolVol.placeVolume(sensorVol, sensorPlacement);
-
-          // generate LUT for module number -> sensor position, for readout mapping tests
-          // if(isec==0) printf("%d %f %f\n",imod,sensorPV.position().x(),sensorPV.position().y());
-
-          // properties
-          sensorPV.addPhysVolID("sector", isec)
-              .addPhysVolID("module", imod); // NOTE: must be consistent with `sensorIDfields`
-          auto        imodsec    = encodeSensorID(sensorPV.volIDs());
-          std::string modsecName = secName + "_" + std::to_string(imod);
-          DetElement  sensorDE(det, "sensor_de_" + modsecName, imodsec);
-          sensorDE.setPlacement(sensorPV);
-          if (!debugOptics || debugOpticsMode == 3) {
-            SkinSurface sensorSkin(desc, sensorDE, "sensor_optical_surface_" + modsecName, sensorSurf, sensorVol);
-            sensorSkin.isValid();
-          }
-
-          // increment sensor module number
-          imod++;
-
-        } // end patch cuts
-      }   // end phiGen loop
-    }     // end thetaGen loop
+    // the tiling is the same in every sector, only the sector rotation differs
+    for (const auto& tilePlacement : sensorTilePlacements) {
+
+      // placement (note: transformations are in reverse order)
+      auto sensorPlacement =
+          sectorRotation *                                                      // rotate about beam axis to sector
+          Translation3D(sensorSphPos.x(), sensorSphPos.y(), sensorSphPos.z()) * // move sphere to reference position
+          tilePlacement;                                                        // move to tile on the sphere
+      auto sensorPV = gasvolVol.placeVolume(sensorVol, sensorPlacement);
+
+      // properties
+      sensorPV.addPhysVolID("sector", isec)
+          .addPhysVolID("module", imod); // NOTE: must be consistent with `sensorIDfields`
+      auto        imodsec    = encodeSensorID(sensorPV.volIDs());
+      std::string modsecName = secName + "_" + std::to_string(imod);
+      DetElement  sensorDE(det, "sensor_de_" + modsecName, imodsec);
+      sensorDE.setPlacement(sensorPV);
+
+      // increment sensor module number
+      imod++;
+    }
+
+    // optical surface: a skin surface applies to every placement of the logical volume, so a single
+    // one for this sector's sensor volume suffices, instead of one per sensor
+    if (!debugOptics || debugOpticsMode == 3) {
+      SkinSurface sensorSkin(desc, det, "sensor_optical_surface_" + secName, sensorSurf, sensorVol);
+      sensorSkin.isValid();
+    }
 
     // calculate centroid sensor position
     // if (isec == 0) {
@@ -8,6 +8,7 @@
 //==========================================================================
 
 #include "DD4hep/DetFactoryHelper.h"
+#include "GeometryDetail.h"
 #include <XML/Helper.h>
 #include <XML/Layering.h>
 
@@ -28,6 +29,9 @@ static Ref_t createDetector(Detector& desc, xml_h handle, SensitiveDetector sens
 
   Material air = desc.material("Air");
 
+  // Homogenise each layer section (all repeats of a <layer>) into a single volume of the mixture
+  bool homogenize = dd4hep::getAttrOrDefault<bool>(detElem, _Unicode(homogenize), false);
+
   // Getting insert dimensions
   const xml::Component& insert_xml       = detElem.child(_Unicode(insert));
   xml_dim_t             insert_dim       = insert_xml.dimensions();
@@ -52,6 +56,31 @@ static Ref_t createDetector(Detector& desc, xml_h handle, SensitiveDetector sens
     int        repeat          = x_layer.repeat();
     double     layer_thickness = x_layer.thickness();
 
+    if (homogenize) {
+      std::string section_name      = detName + _toString(layer_num, "_layer%d");
+      double      section_thickness = layer_thickness * repeat;
+      auto        mix               = epic::geo::mixLayer(desc, section_name + "_mix", x_layer, layer_thickness);
+
+      Tube             section(rmin, rmax, section_thickness / 2.);
+      Box              section_insert(insert_dim.x() / 2., insert_dim.y() / 2., section_thickness / 2.);
+      SubtractionSolid section_with_inserthole(section, section_insert,
+                                               Position(insert_local_pos.x(), insert_local_pos.y(), 0.));
+      Volume           section_vol(section_name, section_with_inserthole, mix.material);
+      if (mix.sensitive) {
+        sens.setType("calorimeter");
+        section_vol.setSensitiveDetector(sens);
+      }
+      section_vol.setAttributes(desc, x_layer.regionStr(), x_layer.limitsStr(), x_layer.visStr());
+
+      // The section is identified by the number of its first layer
+      pv = envelopeVol.placeVolume(
+          section_vol, Transform3D(RotationZYX(0, 0, 0), Position(0., 0., layer_z + section_thickness / 2.)));
+      pv.addPhysVolID("layer", layer_num);
+      layer_num += repeat;
+      layer_z += section_thickness;
+      continue;
+    }
+
     // Looping through the number of repeated layers in each section
     for (int i = 0; i < repeat; i++) {
       layer_z += layer_thickness / 2.; // Going to halfway point in layer
@@ -43,7 +43,7 @@ static Ref_t create_detector(Detector& description, xml_h e, SensitiveDetector s
   // Add the volume boundary material if configured
   for (xml_coll_t bmat(x_det, _Unicode(boundary_material)); bmat; ++bmat) {
     xml_comp_t x_boundary_material = bmat;
-    DD4hepDetectorHelper::xmlToProtoSurfaceMaterial(x_boundary_material, params,
+    DD4hepDetectorHelper::xmlToProtoSurfaceMaterial(x_boundary_material, ttl_detEl, params,
                                          "boundary_material");
   }
 
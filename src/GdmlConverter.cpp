@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 agent
+
+#include <DD4hep/DetFactoryHelper.h>
+#include <DD4hep/Factories.h>
+#include <DD4hep/Printout.h>
+#include <XML/Utilities.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include "GeometryFragment.h"
+
+using namespace dd4hep;
+
+static void gdml_converter_usage(int argc, char** argv)
+{
+  std::cout << "Usage: -plugin <name> -arg [-arg]                                                  \n"
+               "     name:   factory name     epic_GdmlConverter                                   \n"
+               "     gdml:<string>            GDML fragment to convert                             \n"
+               "     output:<string>          output ROOT file (default: <gdml>.root, which is     \n"
+               "                              preferred by DD4hep_GdmlDetector when up to date)    \n"
+               "\tArguments given: "
+            << arguments(argc, argv) << std::endl;
+  std::exit(EINVAL);
+}
+
+// Plugin to convert a GDML fragment into a ROOT file with the parsed geometry
+long convert_gdml(Detector& desc, int argc, char** argv)
+{
+  // argument parsing
+  std::string gdml, output;
+  for (int i = 0; i < argc && argv[i]; ++i) {
+    if (0 == std::strncmp("gdml:", argv[i], 5))
+      gdml = (argv[i] + 5);
+    else if (0 == std::strncmp("output:", argv[i], 7))
+      output = (argv[i] + 7);
+    else
+      gdml_converter_usage(argc, argv);
+  }
+  if (gdml.empty()) {
+    gdml_converter_usage(argc, argv);
+  }
+  if (output.empty()) {
+    output = epic::geo::fragmentPath(gdml);
+  }
+
+  if (!epic::geo::writeFragment(desc, gdml, output)) {
+    except("GdmlConverter", "+++ Failed to convert GDML file:%s to %s", gdml.c_str(), output.c_str());
+  }
+  printout(INFO, "GdmlConverter", "+++ Converted %s to %s", gdml.c_str(), output.c_str());
+  return 1;
+}
+
+DECLARE_APPLY(epic_GdmlConverter, convert_gdml)
@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 agent
+
+#include "GeometryDetail.h"
+#include "DD4hep/DetFactoryHelper.h"
+#include "DD4hep/Printout.h"
+#include "TGeoManager.h"
+#include "TGeoMaterial.h"
+#include "TGeoMedium.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace epic::geo {
+
+  // parse a detail level from its name or number, returns false if not recognized
+  static bool parse_detail_level(std::string str, DetailLevel& level)
+  {
+    std::transform(str.begin(), str.end(), str.begin(), [](char c) { return std::tolower(c); });
+    if (str == "full" || str == "0") {
+      level = DetailLevel::full;
+      return true;
+    }
+    if (str == "coarse" || str == "1") {
+      level = DetailLevel::coarse;
+      return true;
+    }
+    return false;
+  }
+
+  DetailLevel detailLevel(const dd4hep::Detector& desc)
+  {
+    DetailLevel level = DetailLevel::full;
+
+    // environment overrides the compact file
+    const char* env = std::getenv("EPIC_GEOMETRY_DETAIL");
+    if (env != nullptr) {
+      if (parse_detail_level(env, level)) {
+        return level;
+      }
+      dd4hep::printout(dd4hep::WARNING, "GeometryDetail", "unrecognized EPIC_GEOMETRY_DETAIL=%s, ignored", env);
+    }
+
+    const auto& constants = desc.constants();
+    if (constants.find("EPIC_geometry_detail") != constants.end()) {
+      long value = desc.constantAsLong("EPIC_geometry_detail");
+      if (!parse_detail_level(std::to_string(value), level)) {
+        dd4hep::printout(dd4hep::WARNING, "GeometryDetail", "unrecognized EPIC_geometry_detail=%ld, ignored", value);
+      }
+    }
+    return level;
+  }
+
+  dd4hep::Material mixMaterial(const dd4hep::Detector& desc, const std::string& name,
+                               const std::vector<std::pair<dd4hep::Material, double>>& components)
+  {
+    // medium ids for generated mixtures, counting down from below the range used by the compact materials
+    static int unique_mix_id = 0xFF000;
+
+    TGeoManager& mgr = desc.manager();
+    if (TGeoMedium* medium = mgr.GetMedium(name.c_str())) {
+      return dd4hep::Material(medium);
+    }
+
+    // total volume and mass in TGeo units, mass fractions follow from them
+    double volume = 0., mass = 0.;
+    int    nelements = 0;
+    for (const auto& [mat, vol] : components) {
+      if (vol <= 0.) {
+        continue;
+      }
+      TGeoMaterial* m = mat->GetMaterial();
+      volume += vol;
+      mass += vol * m->GetDensity();
+      nelements += m->IsMixture() ? static_cast<TGeoMixture*>(m)->GetNelements() : 1;
+    }
+    if (volume <= 0. || mass <= 0.) {
+      throw std::runtime_error("GeometryDetail: cannot build mixture " + name + " from empty components");
+    }
+
+    auto mix = new TGeoMixture(name.c_str(), nelements, mass / volume);
+    for (const auto& [mat, vol] : components) {
+      if (vol <= 0.) {
+        continue;
+      }
+      TGeoMaterial* m = mat->GetMaterial();
+      double        w = vol * m->GetDensity() / mass;
+      if (m->IsMixture()) {
+        auto sub = static_cast<TGeoMixture*>(m);
+        for (int i = 0; i < sub->GetNelements(); ++i) {
+          mix->AddElement(sub->GetElement(i), w * sub->GetWmixt()[i]);
+        }
+      } else {
+        mix->AddElement(m->GetElement(), w);
+      }
+    }
+
+    auto medium = new TGeoMedium(name.c_str(), unique_mix_id, mix);
+    medium->SetTitle("material");
+    medium->SetUniqueID(unique_mix_id);
+    --unique_mix_id;
+
+    dd4hep::printout(dd4hep::DEBUG, "GeometryDetail", "created mixture %s with density %.4f g/cm3 from %zu materials",
+                     name.c_str(), mass / volume, components.size());
+    return dd4hep::Material(medium);
+  }
+
+  LayerMixture mixLayer(const dd4hep::Detector& desc, const std::string& name, dd4hep::xml::Handle_t x_layer,
+                        double thickness)
+  {
+    LayerMixture                                     res;
+    std::vector<std::pair<dd4hep::Material, double>> components;
+    for (xml_coll_t si(x_layer, _U(slice)); si; ++si) {
+      xml_comp_t x_slice = si;
+      components.emplace_back(desc.material(x_slice.materialStr()), x_slice.thickness());
+      res.thickness += x_slice.thickness();
+      res.sensitive |= x_slice.isSensitive();
+    }
+    if (thickness > res.thickness) {
+      components.emplace_back(desc.air(), thickness - res.thickness);
+      res.thickness = thickness;
+    }
+    res.material = mixMaterial(desc, name, components);
+    return res;
+  }
+
+} // namespace epic::geo
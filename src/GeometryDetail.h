@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 agent
+
+#pragma once
+#include "DD4hep/Detector.h"
+#include "DD4hep/Objects.h"
+#include "XML/XMLElements.h"
+#include <string>
+#include <utility>
+#include <vector>
+
+// geometry detail level and material homogenisation shared by the detector builders
+namespace epic::geo {
+
+  /** Level of detail requested from the detector builders.
+   *
+   * full:   every fiber, wrapper and slice is placed as its own volume (simulation)
+   * coarse: fiber and wrapper structures are replaced by volumes of an equivalent mixture material
+   *         (reconstruction, event display, ACTS conversion)
+   */
+  enum class DetailLevel { full = 0, coarse = 1 };
+
+  /** Get the geometry detail level.
+   *
+   * The environment variable EPIC_GEOMETRY_DETAIL (full/coarse or 0/1) takes precedence over the
+   * compact constant EPIC_geometry_detail. Without either, the full detail level is used.
+   */
+  DetailLevel detailLevel(const dd4hep::Detector& desc);
+
+  inline bool isCoarse(const dd4hep::Detector& desc) { return detailLevel(desc) == DetailLevel::coarse; }
+
+  /** Get or create a homogenised mixture of materials.
+   *
+   * @param name        name of the mixture, an existing material with the same name is returned as is
+   * @param components  materials and their volumes (or volume fractions, only the ratios matter)
+   *
+   * The mass fractions and the density of the mixture are derived from the volumes and the component densities,
+   * components which are mixtures themselves are expanded into their elements.
+   */
+  dd4hep::Material mixMaterial(const dd4hep::Detector& desc, const std::string& name,
+                               const std::vector<std::pair<dd4hep::Material, double>>& components);
+
+  /// Homogenised material of a sampling layer, see mixLayer()
+  struct LayerMixture {
+    dd4hep::Material material;
+    double           thickness = 0.;    // thickness of a single layer
+    bool             sensitive = false; // true if any of the slices is sensitive
+  };
+
+  /** Homogenise the <slice> stack of a sampling calorimeter <layer> into one mixture material.
+   *
+   * @param name       name of the mixture material
+   * @param x_layer    layer element with <slice material="..." thickness="..."/> children
+   * @param thickness  layer thickness, any space not taken by the slices is filled with air (default: sum of slices)
+   *
+   * The slices are weighted by their thickness, which is their volume fraction when they share the same cross section.
+   */
+  LayerMixture mixLayer(const dd4hep::Detector& desc, const std::string& name, dd4hep::xml::Handle_t x_layer,
+                        double thickness = 0.);
+
+} // namespace epic::geo
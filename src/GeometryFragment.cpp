@@ -0,0 +1,280 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 agent
+
+#include "GeometryFragment.h"
+#include "DD4hep/Printout.h"
+#include "TFile.h"
+#include "TGDMLParse.h"
+#include "TGeoElement.h"
+#include "TGeoManager.h"
+#include "TGeoMaterial.h"
+#include "TGeoMatrix.h"
+#include "TGeoMedium.h"
+#include "TGeoNode.h"
+#include "TGeoVolume.h"
+#include "TList.h"
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+
+namespace epic::geo {
+
+  namespace {
+
+    // restores gGeoManager after it is pointed at the geometry manager of a detector description
+    class CurrentManagerGuard {
+    public:
+      CurrentManagerGuard() : m_manager(gGeoManager) {}
+      ~CurrentManagerGuard() { gGeoManager = m_manager; }
+
+    private:
+      TGeoManager* m_manager;
+    };
+
+    /* copies a volume tree of a fragment geometry into the live geometry manager
+     *
+     * Elements are taken from the element table of the live manager, materials and media are matched by name
+     * and only created if missing, with medium IDs after the ones in use. Shapes are cloned and volumes are
+     * rebuilt, so nothing of the streamed fragment tree is referenced by the live geometry. Trees with constructs
+     * which cannot be copied faithfully (divisions, optical properties, isotope compositions which differ from
+     * the live elements) are rejected by check() before anything is added to the live manager.
+     */
+    class FragmentCopy {
+    public:
+      explicit FragmentCopy(TGeoManager& live) : m_live(live) {}
+
+      bool check(TGeoVolume* vol)
+      {
+        if (!m_checked.insert(vol).second) {
+          return true;
+        }
+        if (vol->IsA() != TGeoVolume::Class() && vol->IsA() != TGeoVolumeAssembly::Class()) {
+          return reject("volume %s of type %s", vol->GetName(), vol->ClassName());
+        }
+        if (!vol->IsAssembly() && m_live.GetMedium(vol->GetMedium()->GetName()) == nullptr) {
+          const TGeoMaterial* mat = vol->GetMedium()->GetMaterial();
+          if (mat->GetNproperties() > 0 || mat->GetNconstProperties() > 0) {
+            return reject("material %s with optical properties", mat->GetName());
+          }
+          if (m_live.GetMaterial(mat->GetName()) == nullptr) {
+            if (mat->IsMixture()) {
+              auto* mix = static_cast<const TGeoMixture*>(mat);
+              for (int i = 0; i < mix->GetNelements(); ++i) {
+                if (element(mix->GetElement(i)) == nullptr) {
+                  return false;
+                }
+              }
+            } else if (element(mat->GetBaseElement()) == nullptr) {
+              return false;
+            }
+          }
+        }
+        for (int i = 0; i < vol->GetNdaughters(); ++i) {
+          TGeoNode* node = vol->GetNode(i);
+          if (node->IsA() != TGeoNodeMatrix::Class()) {
+            return reject("node %s of type %s", node->GetName(), node->ClassName());
+          }
+          if (!check(node->GetVolume())) {
+            return false;
+          }
+        }
+        return true;
+      }
+
+      /// Copy of a volume tree which passed check()
+      TGeoVolume* volume(TGeoVolume* vol)
+      {
+        if (auto it = m_volumes.find(vol); it != m_volumes.end()) {
+          return it->second;
+        }
+        TGeoVolume* copy = vol->IsAssembly() ? new TGeoVolumeAssembly(vol->GetName())
+                                             : new TGeoVolume(vol->GetName(), shape(vol->GetShape()),
+                                                              medium(vol->GetMedium()));
+        m_volumes.emplace(vol, copy);
+        for (int i = 0; i < vol->GetNdaughters(); ++i) {
+          TGeoNode* node   = vol->GetNode(i);
+          auto*     matrix = new TGeoHMatrix(*node->GetMatrix());
+          matrix->RegisterYourself();
+          if (node->IsOverlapping()) {
+            copy->AddNodeOverlap(volume(node->GetVolume()), node->GetNumber(), matrix);
+          } else {
+            copy->AddNode(volume(node->GetVolume()), node->GetNumber(), matrix);
+          }
+        }
+        return copy;
+      }
+
+      std::size_t size() const { return m_volumes.size(); }
+
+    private:
+      template <typename... Args> bool reject(const char* format, Args... args)
+      {
+        dd4hep::printout(dd4hep::INFO, "GeometryFragment", (std::string("cannot copy ") + format).c_str(), args...);
+        return false;
+      }
+
+      // element of the live element table with the same name, or else the same Z, and the same A
+      TGeoElement* element(const TGeoElement* elem)
+      {
+        TGeoElementTable* table = m_live.GetElementTable();
+        TGeoElement*      known = table->FindElement(elem->GetName());
+        if (known == nullptr || known->Z() != elem->Z()) {
+          known = table->GetElement(elem->Z());
+        }
+        if (known == nullptr || std::abs(known->A() - elem->A()) > 1e-3 * elem->A()) {
+          reject("element %s (Z=%d, A=%g)", elem->GetName(), elem->Z(), elem->A());
+          return nullptr;
+        }
+        return known;
+      }
+
+      TGeoShape* shape(TGeoShape* shp)
+      {
+        auto& copy = m_shapes[shp];
+        if (copy == nullptr) {
+          copy = static_cast<TGeoShape*>(shp->Clone());
+          m_live.AddShape(copy);
+        }
+        return copy;
+      }
+
+      TGeoMaterial* material(const TGeoMaterial* mat)
+      {
+        if (TGeoMaterial* known = m_live.GetMaterial(mat->GetName())) {
+          if (std::abs(known->GetDensity() - mat->GetDensity()) > 1e-6 * mat->GetDensity()) {
+            dd4hep::printout(dd4hep::WARNING, "GeometryFragment",
+                             "material %s: density %g of the fragment differs from the known %g, using the known one",
+                             mat->GetName(), mat->GetDensity(), known->GetDensity());
+          }
+          return known;
+        }
+        TGeoMaterial* copy = nullptr;
+        if (mat->IsMixture()) {
+          auto* mix = static_cast<const TGeoMixture*>(mat);
+          auto* m   = new TGeoMixture(mat->GetName(), mix->GetNelements(), mat->GetDensity());
+          for (int i = 0; i < mix->GetNelements(); ++i) {
+            m->AddElement(element(mix->GetElement(i)), mix->GetWmixt()[i]);
+          }
+          copy = m;
+        } else {
+          copy = new TGeoMaterial(mat->GetName(), element(mat->GetBaseElement()), mat->GetDensity());
+        }
+        copy->SetState(mat->GetState());
+        copy->SetTemperature(mat->GetTemperature());
+        copy->SetPressure(mat->GetPressure());
+        return copy;
+      }
+
+      TGeoMedium* medium(const TGeoMedium* med)
+      {
+        if (TGeoMedium* known = m_live.GetMedium(med->GetName())) {
+          return known;
+        }
+        // next free medium ID, so the new medium does not clash with any medium in use
+        int id = 0;
+        for (TObject* obj : *m_live.GetListOfMedia()) {
+          id = std::max(id, static_cast<TGeoMedium*>(obj)->GetId());
+        }
+        double params[20];
+        for (int i = 0; i < 20; ++i) {
+          params[i] = med->GetParam(i);
+        }
+        auto* copy = new TGeoMedium(med->GetName(), id + 1, material(med->GetMaterial()), params);
+        copy->SetTitle("material");
+        return copy;
+      }
+
+      TGeoManager&                       m_live;
+      std::set<TGeoVolume*>              m_checked;
+      std::map<TGeoVolume*, TGeoVolume*> m_volumes;
+      std::map<TGeoShape*, TGeoShape*>   m_shapes;
+    };
+
+    // key of the top volume in the fragment file
+    constexpr const char* fragment_key = "fragment";
+
+    // number of optical surfaces and property tables of a geometry manager
+    std::size_t optical_entries(TGeoManager& mgr)
+    {
+      auto entries = [](TCollection* list) -> std::size_t { return list != nullptr ? list->GetEntries() : 0; };
+      return entries(mgr.GetListOfOpticalSurfaces()) + entries(mgr.GetListOfSkinSurfaces()) +
+             entries(mgr.GetListOfBorderSurfaces()) + entries(mgr.GetListOfGDMLMatrices());
+    }
+
+  } // namespace
+
+  std::string fragmentPath(const std::string& gdml) { return gdml + ".root"; }
+
+  bool hasFragment(const std::string& gdml)
+  {
+    namespace fs = std::filesystem;
+    std::error_code ec;
+    auto            fragment_time = fs::last_write_time(fragmentPath(gdml), ec);
+    if (ec) {
+      return false;
+    }
+    auto gdml_time = fs::last_write_time(gdml, ec);
+    return !ec && fragment_time >= gdml_time;
+  }
+
+  bool writeFragment(dd4hep::Detector& desc, const std::string& gdml, const std::string& path)
+  {
+    // the GDML parser creates its objects in the current geometry manager, which must be the live one:
+    // a second TGeoManager would delete the live one on construction
+    TGeoManager&        live = desc.manager();
+    CurrentManagerGuard guard;
+    gGeoManager = &live;
+
+    std::size_t optical_before = optical_entries(live);
+    TGDMLParse  parser;
+    TGeoVolume* top = parser.GDMLReadFile(gdml.c_str());
+    if (top == nullptr) {
+      dd4hep::printout(dd4hep::ERROR, "GeometryFragment", "cannot parse %s", gdml.c_str());
+      return false;
+    }
+    if (optical_entries(live) != optical_before) {
+      // optical surfaces and property tables are not part of the volume tree, they would be lost
+      dd4hep::printout(dd4hep::ERROR, "GeometryFragment", "%s has optical surfaces or properties, not converted",
+                       gdml.c_str());
+      return false;
+    }
+
+    TFile file(path.c_str(), "RECREATE");
+    bool  ok = !file.IsZombie() && top->Write(fragment_key) > 0;
+    file.Close();
+    if (!ok) {
+      dd4hep::printout(dd4hep::ERROR, "GeometryFragment", "cannot write %s", path.c_str());
+    }
+    return ok;
+  }
+
+  dd4hep::Volume readFragment(dd4hep::Detector& desc, const std::string& path)
+  {
+    TGeoManager&        live = desc.manager();
+    CurrentManagerGuard guard;
+    gGeoManager = &live;
+
+    std::unique_ptr<TFile> file(TFile::Open(path.c_str(), "READ"));
+    TGeoVolume* fragment = file != nullptr && !file->IsZombie()
+                               ? dynamic_cast<TGeoVolume*>(file->Get(fragment_key))
+                               : nullptr;
+    if (fragment == nullptr) {
+      dd4hep::printout(dd4hep::WARNING, "GeometryFragment", "no geometry fragment in %s", path.c_str());
+      return dd4hep::Volume();
+    }
+    // the streamed tree is not registered with any geometry manager and is only read from; it is small and has no
+    // single owner of its shapes, media and matrices, so it is kept rather than taken apart
+    FragmentCopy copy(live);
+    if (!copy.check(fragment)) {
+      return dd4hep::Volume();
+    }
+    TGeoVolume* vol = copy.volume(fragment);
+    dd4hep::printout(dd4hep::DEBUG, "GeometryFragment", "read %zu volumes from %s", copy.size(), path.c_str());
+    return dd4hep::Volume(vol);
+  }
+
+} // namespace epic::geo
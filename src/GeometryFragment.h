@@ -0,0 +1,38 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 agent
+
+#pragma once
+#include "DD4hep/Detector.h"
+#include "DD4hep/Volumes.h"
+#include <string>
+
+// pre-converted ROOT files of imported (GDML) geometry fragments
+namespace epic::geo {
+
+  /// Path of the pre-converted ROOT file of a GDML fragment
+  std::string fragmentPath(const std::string& gdml);
+
+  /// True if the pre-converted ROOT file of a GDML fragment exists and is not older than the GDML file
+  bool hasFragment(const std::string& gdml);
+
+  /** Convert a GDML fragment into a ROOT file.
+   *
+   * The fragment is parsed into the geometry manager of the detector description (no second TGeoManager is
+   * created inside a DD4hep process), and its top volume is written with TFile, together with the volumes,
+   * shapes, media and materials it refers to. Fragments with optical surfaces or property tables are not
+   * converted, since those are not part of the volume tree.
+   * Returns false if the fragment cannot be parsed or converted, or the file cannot be written.
+   */
+  bool writeFragment(dd4hep::Detector& desc, const std::string& gdml, const std::string& path);
+
+  /** Read a geometry fragment written by writeFragment() into the geometry of a detector description.
+   *
+   * The top volume is read with TFile, and its volume tree is copied into the geometry manager of the detector
+   * description: media and materials are matched by name and only added if missing, with free medium IDs and the
+   * elements of the existing element table.
+   * Returns an invalid volume if the file cannot be read, or if the fragment cannot be copied faithfully (e.g. it
+   * has materials with optical properties), in which case the GDML file should be parsed instead.
+   */
+  dd4hep::Volume readFragment(dd4hep::Detector& desc, const std::string& path);
+
+} // namespace epic::geo
@@ -2,6 +2,8 @@
 // Copyright (C) 2022 Chao Peng, Whitney Armstrong
 
 #include "GeometryHelpers.h"
+#include <algorithm>
+#include <cmath>
 
 // some utility functions that can be shared
 namespace epic::geo {
@@ -85,6 +87,55 @@ namespace epic::geo {
     return res;
   }
 
+  SquareGrid squareGridInRing(double pitch, double rmin, double rmax, double size, bool half_offset,
+                              double half_width)
+  {
+    const double offset = half_offset ? 0.5 : 0.;
+    const double h      = size / 2.;
+    const double rmin2  = rmin * rmin;
+    const double rmax2  = rmax * rmax;
+
+    // square at (ux, uy) with ux, uy >= 0 is in the ring: its farthest corner inside rmax and its
+    // nearest point outside rmin
+    auto in_ring = [&](double ux, double uy) {
+      double nx = std::max(0., ux - h), ny = std::max(0., uy - h);
+      return (ux + h) * (ux + h) + (uy + h) * (uy + h) <= rmax2 && nx * nx + ny * ny >= rmin2;
+    };
+    // signed index of the column or row at |u| = (i + offset) * pitch
+    auto index = [&](int i, int sign) { return sign > 0 ? i : -i - (half_offset ? 1 : 0); };
+
+    SquareGrid res;
+    for (int i = 0; (i + offset) * pitch <= half_width; ++i) {
+      double ux   = (i + offset) * pitch;
+      double umax = rmax2 - (ux + h) * (ux + h);
+      if (umax < 0) {
+        break;
+      }
+      // row range of this column from the ring, widened by one row on both ends to absorb the rounding,
+      // the rows are then checked exactly
+      double dx   = std::max(0., ux - h);
+      double ymin = rmin2 > dx * dx ? std::sqrt(rmin2 - dx * dx) + h : 0.;
+      double ymax = std::min(std::sqrt(umax) - h, half_width);
+      int    jmin = std::max(0, static_cast<int>(std::ceil(ymin / pitch - offset)) - 1);
+      int    jmax = static_cast<int>(std::floor(ymax / pitch - offset)) + 1;
+      for (int sgnx = 1; sgnx >= (ux > 0 ? -1 : 1); sgnx -= 2) {
+        for (int j = jmin; j <= jmax; ++j) {
+          double uy = (j + offset) * pitch;
+          if (uy > half_width || !in_ring(ux, uy)) {
+            continue;
+          }
+          for (int sgny = 1; sgny >= (uy > 0 ? -1 : 1); sgny -= 2) {
+            res.x.push_back(sgnx * ux);
+            res.y.push_back(sgny * uy);
+            res.col.push_back(index(i, sgnx));
+            res.row.push_back(index(j, sgny));
+          }
+        }
+      }
+    }
+    return res;
+  }
+
   // check if a regular polygon is inside a ring
   bool poly_in_ring(const Point& p, int nsides, double lside, double rmin, double rmax, double phmin, double phmax)
   {
@@ -151,4 +202,150 @@ namespace epic::geo {
     return res;
   }
 
+  // closed-form count of the leading indices [0, n) that satisfy a predicate which fails for all indices beyond,
+  // the estimate is corrected with the predicate itself to reproduce the rounding of an explicit loop
+  template <class Pred>
+  int leading_count(double estimate, int max_count, Pred pred)
+  {
+    int n = std::clamp(static_cast<int>(std::floor(std::clamp(estimate, -1., double(max_count)))), 0, max_count);
+    while (n > 0 && !pred(n - 1)) {
+      --n;
+    }
+    while (n < max_count && pred(n)) {
+      ++n;
+    }
+    return n;
+  }
+
+  // rows and columns of a honeycomb in a rectangle, see honeycombRectangle
+  struct honeycomb_rect_layout {
+    double x0[2], y0, distx, disty;
+    int    nrows, ncols[2];
+
+    honeycomb_rect_layout(double sx, double sy, double radius, double space_x, double space_y, double offset)
+    {
+      double side = 2. / std::sqrt(3.) * radius;
+      distx       = 2. * side + space_x;
+      disty       = 2. * radius + space_y;
+      y0          = offset + side;
+      // even rows are shifted by half a hexagon
+      x0[0] = offset + side + distx / 2.;
+      x0[1] = offset + side;
+
+      // maximum numbers of the fibers
+      int max_cols = int(sx / (2. * radius)) + 1;
+      int max_rows = int(sy / (2. * radius)) + 1;
+
+      // stop before touching the boundary
+      nrows = leading_count((sy - 2. * y0) / disty + 1., max_rows,
+                            [&](int iy) { return !((sy - (y0 + disty * iy)) < y0); });
+      for (int p = 0; p < 2; ++p) {
+        ncols[p] = leading_count((sx - 2. * x0[p]) / distx + 1., max_cols,
+                                 [&](int ix) { return !((sx - (x0[p] + distx * ix)) < x0[p]); });
+      }
+    }
+
+    std::size_t size() const
+    {
+      return std::size_t(ncols[0]) * ((nrows + 1) / 2) + std::size_t(ncols[1]) * (nrows / 2);
+    }
+  };
+
+  std::size_t honeycombRectangleCount(double sx, double sy, double radius, double space_x, double space_y,
+                                      double offset)
+  {
+    return honeycomb_rect_layout(sx, sy, radius, space_x, space_y, offset).size();
+  }
+
+  Honeycomb honeycombRectangle(double sx, double sy, double radius, double space_x, double space_y, double offset)
+  {
+    honeycomb_rect_layout layout(sx, sy, radius, space_x, space_y, offset);
+
+    Honeycomb res;
+    res.x.reserve(layout.size());
+    res.y.reserve(layout.size());
+    res.col.reserve(layout.size());
+    res.row.reserve(layout.size());
+    res.row_begin.reserve(layout.nrows + 1);
+    for (int iy = 0; iy < layout.nrows; ++iy) {
+      res.row_begin.push_back(res.size());
+      double y  = layout.y0 + layout.disty * iy - sy / 2.;
+      double x0 = layout.x0[iy % 2] - sx / 2.;
+      for (int ix = 0; ix < layout.ncols[iy % 2]; ++ix) {
+        res.x.push_back(x0 + layout.distx * ix);
+        res.y.push_back(y);
+        res.col.push_back(ix);
+        res.row.push_back(iy);
+      }
+    }
+    res.row_begin.push_back(res.size());
+    return res;
+  }
+
+  // rows of a honeycomb in a trapezoid, see honeycombTrapezoid
+  struct honeycomb_trap_layout {
+    int              nlayers;
+    std::vector<int> nhalf; // number of fibers on each side of x = 0 (including x = 0 for even rows)
+
+    honeycomb_trap_layout(double radius, double x_spacing, double y_spacing, double x, double y, double phi,
+                          double tol)
+    {
+      // number of rows that fit in y/2
+      nlayers = std::max(int(std::floor((y / 2. - radius - tol) / y_spacing)), -1);
+      for (int l = -nlayers; l < nlayers + 1; ++l) {
+        double x_max   = x + (y / 2. + l * y_spacing) * std::tan(phi) - tol; // max x at this row
+        double x_start = (l % 2 == 0) ? 0. : x_spacing / 2.;
+        double x_lim   = x_max - radius;
+        nhalf.push_back(leading_count((x_lim - x_start) / x_spacing + 1., int(std::max(x_lim, 0.) / x_spacing) + 2,
+                                      [&](int k) { return x_start + x_spacing * k < x_lim; }));
+      }
+    }
+
+    int row_size(int l, int n) const { return (l % 2 == 0) ? std::max(2 * n - 1, 0) : 2 * n; }
+
+    std::size_t size() const
+    {
+      std::size_t n = 0;
+      for (int l = -nlayers; l < nlayers + 1; ++l) {
+        n += row_size(l, nhalf[l + nlayers]);
+      }
+      return n;
+    }
+  };
+
+  std::size_t honeycombTrapezoidCount(double radius, double x_spacing, double y_spacing, double x, double y,
+                                      double phi, double tol)
+  {
+    return honeycomb_trap_layout(radius, x_spacing, y_spacing, x, y, phi, tol).size();
+  }
+
+  Honeycomb honeycombTrapezoid(double radius, double x_spacing, double y_spacing, double x, double y, double phi,
+                               double tol)
+  {
+    honeycomb_trap_layout layout(radius, x_spacing, y_spacing, x, y, phi, tol);
+
+    Honeycomb res;
+    res.x.reserve(layout.size());
+    res.y.reserve(layout.size());
+    res.col.reserve(layout.size());
+    res.row.reserve(layout.size());
+    res.row_begin.reserve(layout.nhalf.size() + 1);
+    for (int l = -layout.nlayers; l < layout.nlayers + 1; ++l) {
+      res.row_begin.push_back(res.size());
+      int    n       = layout.nhalf[l + layout.nlayers];
+      int    nrow    = layout.row_size(l, n);
+      double x_start = (l % 2 == 0) ? 0. : x_spacing / 2.;
+      // sorted by x: the mirrored side first, then the positive side
+      for (int i = 0; i < nrow; ++i) {
+        int k = (i < nrow / 2) ? (n - 1 - i) : (i - nrow / 2);
+        res.x.push_back((i < nrow / 2 ? -1. : 1.) * (x_start + x_spacing * k));
+        res.y.push_back(l * y_spacing);
+        res.col.push_back(i);
+        res.row.push_back(l + layout.nlayers);
+      }
+    }
+    res.row_begin.push_back(res.size());
+    return res;
+  }
+
 } // namespace epic::geo
@@ -3,6 +3,8 @@
 
 #pragma once
 #include "Math/Point2D.h"
+#include <cstddef>
+#include <limits>
 #include <vector>
 
 // some utility functions that can be shared
@@ -32,4 +34,91 @@ namespace epic::geo {
   std::vector<Point> fillHexagons(Point ref, double lside, double rmin, double rmax, double phmin = -M_PI,
                                   double phmax = M_PI);
 
+  /** Centers of a square grid, stored as contiguous coordinate arrays.
+   *
+   * col and row are the signed grid indices of the centers, x = (col + o) * pitch and y = (row + o) * pitch,
+   * with o = 0 for a grid centered at (0, 0), or o = 0.5 for a grid offset by half a pitch.
+   */
+  struct SquareGrid {
+    std::vector<double> x, y;
+    std::vector<int>    col, row;
+
+    std::size_t size() const { return x.size(); }
+  };
+
+  /** Fill squares of a grid symmetric about the axes into a ring (disk).
+   *
+   * The row range of each column follows from the ring in closed form, and the centers are computed from
+   * their integer indices, so they are exact and independent of the grid size. The centers are ordered
+   * by the distance of the column from the y axis, +x before -x, and within a column likewise in y.
+   *
+   * @param pitch       distance between the centers
+   * @param rmin        inner radius of the ring
+   * @param rmax        outer radius of the ring
+   * @param size        side length of the squares that must be fully contained in the ring, 0 to only
+   *                    require the centers in the ring
+   * @param half_offset offset the grid by half a pitch, instead of centering a square at (0, 0)
+   * @param half_width  maximum |x| and |y| of the centers
+   */
+  SquareGrid squareGridInRing(double pitch, double rmin, double rmax, double size = 0., bool half_offset = false,
+                              double half_width = std::numeric_limits<double>::infinity());
+
+  /** Fiber centers of a honeycomb lattice, stored as contiguous coordinate arrays.
+   *
+   * Fibers are stored row by row and sorted by x within a row, the fibers of row i are the entries
+   * [row_begin[i], row_begin[i + 1]) of the arrays. Rows may be empty.
+   */
+  struct Honeycomb {
+    std::vector<double>      x, y;      // fiber centers
+    std::vector<int>         col, row;  // column (within the row) and row index of the fibers, starting from 0
+    std::vector<std::size_t> row_begin; // nrows() + 1 offsets into the arrays
+
+    std::size_t size() const { return x.size(); }
+    std::size_t nrows() const { return row_begin.empty() ? 0 : row_begin.size() - 1; }
+  };
+
+  /** Fill fibers in a honeycomb into a rectangle centered at (0, 0).
+   *
+   * Fibers are placed in a honeycomb with the radius = sqrt(3)/2. * hexagon side length
+   * So each fiber is fully contained in a regular hexagon, which are placed as
+   *           ______________________________________
+   *           |          ____        ____          |
+   * even:     |         /    \      /    \         |
+   *           |    ____/      \____/      \____    |
+   *           |   /    \      /    \      /    \   |
+   * odd:      |  /      \____/      \____/      \  |
+   *           |  \      /    \      /    \      /  |
+   *           |   \____/      \____/      \____/   |
+   * even:     |        \      /    \      /        |
+   *           |         \____/      \____/      ___|___
+   *           |____________________________________|___offset
+   *                                              | |
+   *                                              |offset
+   *
+   * @param sx       x side length of the rectangle
+   * @param sy       y side length of the rectangle
+   * @param radius   fiber radius
+   * @param space_x  additional space between the hexagons in x
+   * @param space_y  additional space between the hexagons in y
+   * @param offset   minimum distance between the hexagons and the rectangle edges
+   */
+  Honeycomb   honeycombRectangle(double sx, double sy, double radius, double space_x, double space_y, double offset);
+  std::size_t honeycombRectangleCount(double sx, double sy, double radius, double space_x, double space_y,
+                                      double offset);
+
+  /** Fill fibers in a honeycomb into a trapezoid, rows run along x and are symmetric around x = 0.
+   *
+   * @param radius     fiber radius
+   * @param x_spacing  distance between fiber centers in a row
+   * @param y_spacing  distance between rows, odd rows are shifted by x_spacing/2
+   * @param x          half-length of the shorter (bottom) base of the trapezoid
+   * @param y          height of the trapezoid, centered at y = 0
+   * @param phi        angle between y and the trapezoid arm
+   * @param tol        spacing tolerance to the trapezoid edges
+   */
+  Honeycomb   honeycombTrapezoid(double radius, double x_spacing, double y_spacing, double x, double y, double phi,
+                                 double tol = 1e-2);
+  std::size_t honeycombTrapezoidCount(double radius, double x_spacing, double y_spacing, double x, double y,
+                                      double phi, double tol = 1e-2);
+
 } // namespace epic::geo
@@ -23,10 +23,12 @@
 
 #include "DD4hep/DetFactoryHelper.h"
 #include "DD4hep/Printout.h"
+#include "GeometryDetail.h"
 #include "GeometryHelpers.h"
 #include <XML/Helper.h>
 #include <algorithm>
 #include <iostream>
+#include <map>
 #include <math.h>
 #include <tuple>
 
@@ -124,17 +126,20 @@ using namespace dd4hep;
  * @{
  */
 
+// module volumes and sizes shared by the placement blocks, keyed by the module definition
+using ModuleCache = std::map<std::string, std::tuple<Volume, Position>>;
+
 // headers
 static std::tuple<int, int> add_individuals(Detector& desc, Assembly& env, xml::Collection_t& plm,
-                                            SensitiveDetector& sens, int id);
+                                            SensitiveDetector& sens, ModuleCache& cache, int id);
 static std::tuple<int, int> add_array(Detector& desc, Assembly& env, xml::Collection_t& plm, SensitiveDetector& sens,
-                                      int id);
+                                      ModuleCache& cache, int id);
 static std::tuple<int, int> add_disk(Detector& desc, Assembly& env, xml::Collection_t& plm, SensitiveDetector& sens,
-                                     int id);
+                                     ModuleCache& cache, int id);
 static std::tuple<int, int> add_12surface_disk(Detector& desc, Assembly& env, xml::Collection_t& plm,
-                                               SensitiveDetector& sens, int id);
+                                               SensitiveDetector& sens, ModuleCache& cache, int id);
 static std::tuple<int, int> add_lines(Detector& desc, Assembly& env, xml::Collection_t& plm, SensitiveDetector& sens,
-                                      int id);
+                                      ModuleCache& cache, int id);
 
 // helper function to get x, y, z if defined in a xml component
 template <class XmlComp>
@@ -162,8 +167,9 @@ static Ref_t create_detector(Detector& desc, xml::Handle_t handle, SensitiveDete
   // assembly
   Assembly assembly(detName);
 
-  // module placement
+  // module placement, identical module definitions share one volume
   xml::Component     plm = detElem.child(_Unicode(placements));
+  ModuleCache        moduleCache;
   std::map<int, int> sectorModuleNumbers;
   auto               addModuleNumbers = [&sectorModuleNumbers](int sector, int nmod) {
     auto it = sectorModuleNumbers.find(sector);
@@ -175,23 +181,23 @@ static Ref_t create_detector(Detector& desc, xml::Handle_t handle, SensitiveDete
   };
   int sector_id = 1;
   for (xml::Collection_t mod(plm, _Unicode(individuals)); mod; ++mod) {
-    auto [sector, nmod] = add_individuals(desc, assembly, mod, sens, sector_id++);
+    auto [sector, nmod] = add_individuals(desc, assembly, mod, sens, moduleCache, sector_id++);
     addModuleNumbers(sector, nmod);
   }
   for (xml::Collection_t arr(plm, _Unicode(array)); arr; ++arr) {
-    auto [sector, nmod] = add_array(desc, assembly, arr, sens, sector_id++);
+    auto [sector, nmod] = add_array(desc, assembly, arr, sens, moduleCache, sector_id++);
     addModuleNumbers(sector, nmod);
   }
   for (xml::Collection_t disk(plm, _Unicode(disk)); disk; ++disk) {
-    auto [sector, nmod] = add_disk(desc, assembly, disk, sens, sector_id++);
+    auto [sector, nmod] = add_disk(desc, assembly, disk, sens, moduleCache, sector_id++);
     addModuleNumbers(sector, nmod);
   }
   for (xml::Collection_t disk_12surface(plm, _Unicode(disk_12surface)); disk_12surface; ++disk_12surface) {
-    auto [sector, nmod] = add_12surface_disk(desc, assembly, disk_12surface, sens, sector_id++);
+    auto [sector, nmod] = add_12surface_disk(desc, assembly, disk_12surface, sens, moduleCache, sector_id++);
     addModuleNumbers(sector, nmod);
   }
   for (xml::Collection_t lines(plm, _Unicode(lines)); lines; ++lines) {
-    auto [sector, nmod] = add_lines(desc, assembly, lines, sens, sector_id++);
+    auto [sector, nmod] = add_lines(desc, assembly, lines, sens, moduleCache, sector_id++);
     addModuleNumbers(sector, nmod);
   }
 
@@ -253,6 +259,29 @@ std::tuple<Volume, Position> build_module(Detector& desc, xml::Collection_t& plm
     if (carbon_thickness < 1e-12 * mm)
       return std::make_tuple(modVol, Position{sx, sy, sz});
 
+    // coarse detail level: the wrapper structure is folded into the module material
+    if (epic::geo::isCoarse(desc)) {
+      double inner_x    = sx - 2. * carbon_thickness;
+      double inner_y    = sy - 2. * carbon_thickness;
+      double frame_area = sx * sy - inner_x * inner_y;
+      double carbon_vol = 2. * frame_area * length_wrapper;
+      double gap_vol    = frame_area * (sz - 2. * length_wrapper);
+      double wrp_vol    = inner_x * inner_y * (sz + wrap_thickness) -
+                          (inner_x - 2. * wrap_thickness) * (inner_y - 2. * wrap_thickness) * sz;
+      double filler_vol = std::max(sx * sy * (sz + sdz) - cryx * cryy * cryz - carbon_vol - gap_vol - wrp_vol, 0.);
+      // the name encodes the volume fractions of all components, mixMaterial returns a mixture with the same name
+      double mix_vol = filler_vol + carbon_vol + wrp_vol + gap_vol;
+      modVol.setMaterial(epic::geo::mixMaterial(
+          desc,
+          Form("%s_%s_%s_%s_wrapper%.6f_%.6f_%.6f_%.6f", modMat.name(), carbonMat.name(), wrpMat.name(),
+               gapMat.name(), filler_vol / mix_vol, carbon_vol / mix_vol, wrp_vol / mix_vol, gap_vol / mix_vol),
+          {{modMat, filler_vol}, {carbonMat, carbon_vol}, {wrpMat, wrp_vol}, {gapMat, gap_vol}}));
+
+      printout(DEBUG, "HomogeneousCalorimeter", "with homogenised wrapper");
+
+      return std::make_tuple(modVol, Position{sx, sy, sz});
+    }
+
     Box carbonShape(sx / 2., sy / 2., length_wrapper / 2.);
     Box carbonShape_sub((sx - 2. * carbon_thickness) / 2., (sy - 2. * carbon_thickness) / 2., length_wrapper / 2.);
     SubtractionSolid carbon_subtract(carbonShape, carbonShape_sub, Position(0., 0., 0.));
@@ -288,11 +317,42 @@ std::tuple<Volume, Position> build_module(Detector& desc, xml::Collection_t& plm
   }
 }
 
+// key of a module definition, built from the attributes of its <module>, <crystal> and <wrapper> elements
+static std::string module_key(xml::Collection_t& plm)
+{
+  std::string key;
+  for (const xml::Strng_t& tag : {_Unicode(module), _Unicode(crystal), _Unicode(wrapper)}) {
+    if (!plm.hasChild(tag)) {
+      continue;
+    }
+    xml::Handle_t elem = plm.child(tag);
+    key += elem.tag() + "{";
+    for (auto attr : elem.attributes()) {
+      key += xml::_toString(elem.attr_name(attr)) + "=" + xml::_toString(elem.attr_value(attr)) + ";";
+    }
+    key += "}";
+  }
+  return key;
+}
+
+// get the module volume from the cache, build it if this module definition has not been seen yet
+static std::tuple<Volume, Position> get_module(Detector& desc, xml::Collection_t& plm, SensitiveDetector& sens,
+                                               ModuleCache& cache)
+{
+  auto key = module_key(plm);
+  auto it  = cache.find(key);
+  if (it != cache.end()) {
+    printout(DEBUG, "HomogeneousCalorimeter", "reusing module volume %s", std::get<0>(it->second).name());
+    return it->second;
+  }
+  return cache.emplace(key, build_module(desc, plm, sens)).first->second;
+}
+
 // place modules, id must be provided
 static std::tuple<int, int> add_individuals(Detector& desc, Assembly& env, xml::Collection_t& plm,
-                                            SensitiveDetector& sens, int sid)
+                                            SensitiveDetector& sens, ModuleCache& cache, int sid)
 {
-  auto [modVol, modSize] = build_module(desc, plm, sens);
+  auto [modVol, modSize] = get_module(desc, plm, sens, cache);
   int sector_id          = dd4hep::getAttrOrDefault<int>(plm, _Unicode(sector), sid);
   int nmodules           = 0;
   for (xml::Collection_t pl(plm, _Unicode(placement)); pl; ++pl) {
@@ -314,9 +374,9 @@ static std::tuple<int, int> add_individuals(Detector& desc, Assembly& env, xml::
 
 // place array of modules
 static std::tuple<int, int> add_array(Detector& desc, Assembly& env, xml::Collection_t& plm, SensitiveDetector& sens,
-                                      int sid)
+                                      ModuleCache& cache, int sid)
 {
-  auto [modVol, modSize] = build_module(desc, plm, sens);
+  auto [modVol, modSize] = get_module(desc, plm, sens, cache);
   int sector_id          = dd4hep::getAttrOrDefault<int>(plm, _Unicode(sector), sid);
   int id_begin           = dd4hep::getAttrOrDefault<int>(plm, _Unicode(id_begin), 1);
   int nrow               = plm.attr<int>(_Unicode(nrow));
@@ -367,9 +427,9 @@ static std::tuple<int, int> add_array(Detector& desc, Assembly& env, xml::Collec
 
 // place disk of modules
 static std::tuple<int, int> add_disk(Detector& desc, Assembly& env, xml::Collection_t& plm, SensitiveDetector& sens,
-                                     int sid)
+                                     ModuleCache& cache, int sid)
 {
-  auto [modVol, modSize] = build_module(desc, plm, sens);
+  auto [modVol, modSize] = get_module(desc, plm, sens, cache);
   int    sector_id       = dd4hep::getAttrOrDefault<int>(plm, _Unicode(sector), sid);
   int    id_begin        = dd4hep::getAttrOrDefault<int>(plm, _Unicode(id_begin), 1);
   double rmin            = plm.attr<double>(_Unicode(rmin));
@@ -404,9 +464,9 @@ static std::tuple<int, int> add_disk(Detector& desc, Assembly& env, xml::Collect
 
 // place 12 surface disk of modules
 static std::tuple<int, int> add_12surface_disk(Detector& desc, Assembly& env, xml::Collection_t& plm,
-                                               SensitiveDetector& sens, int sid)
+                                               SensitiveDetector& sens, ModuleCache& cache, int sid)
 {
-  auto [modVol, modSize]        = build_module(desc, plm, sens);
+  auto [modVol, modSize]        = get_module(desc, plm, sens, cache);
   int    sector_id              = dd4hep::getAttrOrDefault<int>(plm, _Unicode(sector), sid);
   int    id_begin               = dd4hep::getAttrOrDefault<int>(plm, _Unicode(id_begin), 1);
   double rmin                   = plm.attr<double>(_Unicode(rmin));
@@ -527,9 +587,9 @@ static std::tuple<int, int> add_12surface_disk(Detector& desc, Assembly& env, xm
 
 // place lines of modules (anchor point is the 0th module of this line)
 static std::tuple<int, int> add_lines(Detector& desc, Assembly& env, xml::Collection_t& plm, SensitiveDetector& sens,
-                                      int sid)
+                                      ModuleCache& cache, int sid)
 {
-  auto [modVol, modSize] = build_module(desc, plm, sens);
+  auto [modVol, modSize] = get_module(desc, plm, sens, cache);
   int  sector_id         = dd4hep::getAttrOrDefault<int>(plm, _Unicode(sector), sid);
   int  id_begin          = dd4hep::getAttrOrDefault<int>(plm, _Unicode(id_begin), 1);
   bool mirrorx           = dd4hep::getAttrOrDefault<bool>(plm, _Unicode(mirrorx), false);
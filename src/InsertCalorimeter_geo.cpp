@@ -8,6 +8,7 @@
 //==========================================================================
 
 #include "DD4hep/DetFactoryHelper.h"
+#include "GeometryDetail.h"
 #include <XML/Helper.h>
 #include <XML/Layering.h>
 #include <tuple>
@@ -87,6 +88,9 @@ static Ref_t createDetector(Detector& desc, xml_h handle, SensitiveDetector sens
     return hole_rxy;
   };
 
+  // Homogenise each layer section (all repeats of a <layer>) into a single volume of the mixture
+  bool homogenize = dd4hep::getAttrOrDefault<bool>(detElem, _Unicode(homogenize), false);
+
   // Assembly that will contain all the layers
   Assembly assembly(detName);
 
@@ -104,6 +108,41 @@ static Ref_t createDetector(Detector& desc, xml_h handle, SensitiveDetector sens
     int        repeat          = x_layer.repeat();
     double     layer_thickness = x_layer.thickness();
 
+    if (homogenize) {
+      std::string section_name      = detName + _toString(layer_num, "_layer%d");
+      double      section_thickness = layer_thickness * repeat;
+      auto        mix               = epic::geo::mixLayer(desc, section_name + "_mix", x_layer, layer_thickness);
+
+      /*
+        The hole of the section has to contain the holes of all its layers
+        Use the hole at the front of the last layer, enlarged by the shift of the hole center along the section
+      */
+      const auto first_rxy      = get_hole_rxy(z_distance_traversed);
+      const auto hole_rxy       = get_hole_rxy(z_distance_traversed + section_thickness - layer_thickness);
+      double     hole_x         = std::get<1>(hole_rxy);
+      double     hole_y         = std::get<2>(hole_rxy);
+      double     section_hole_r = std::get<0>(hole_rxy) +
+                                  std::hypot(hole_x - std::get<1>(first_rxy), hole_y - std::get<2>(first_rxy));
+
+      Box              section(width / 2., height / 2., section_thickness / 2.);
+      Tube             section_hole(0., section_hole_r, section_thickness / 2.);
+      SubtractionSolid section_with_hole(section, section_hole, Position(hole_x, hole_y, 0.));
+      Volume           section_vol(section_name, section_with_hole, mix.material);
+      if (mix.sensitive) {
+        sens.setType("calorimeter");
+        section_vol.setSensitiveDetector(sens);
+      }
+      section_vol.setAttributes(desc, x_layer.regionStr(), x_layer.limitsStr(), x_layer.visStr());
+
+      // The section is identified by the number of its first layer
+      double section_z = -length / 2. + z_distance_traversed + section_thickness / 2.;
+      pv = assembly.placeVolume(section_vol, Transform3D(RotationZYX(0, 0, 0), Position(0., 0., section_z)));
+      pv.addPhysVolID("layer", layer_num);
+      layer_num += repeat;
+      z_distance_traversed += section_thickness;
+      continue;
+    }
+
     // Looping through the number of repeated layers in each section
     for (int i = 0; i < repeat; i++) {
       std::string layer_name = detName + _toString(layer_num, "_layer%d");
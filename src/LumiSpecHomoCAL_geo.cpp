@@ -5,6 +5,7 @@
 // Homogeneous PbWO4 (EM Calorimeter) Pair Spectrometer
 
 #include "DD4hep/DetFactoryHelper.h"
+#include "SharedVolumes.h"
 #include <XML/Helper.h>
 #include <algorithm>
 #include <iostream>
@@ -14,7 +15,7 @@ using namespace std;
 using namespace dd4hep;
 
 // Definition of function to build the modules
-static tuple<Volume, Position> build_specHomoCAL_module(const Detector& description, const xml::Component& mod_x, SensitiveDetector& sens);
+static tuple<Volume, Position> build_specHomoCAL_module(Detector& description, const xml::Component& mod_x, SensitiveDetector& sens);
 
 // Driver Function
 static Ref_t create_detector(Detector& description, xml_h e, SensitiveDetector sens)
@@ -83,22 +84,18 @@ static Ref_t create_detector(Detector& description, xml_h e, SensitiveDetector s
 
 //--------------------------------------------------------------------
 //Function for building the module
-static tuple<Volume, Position> build_specHomoCAL_module( const Detector& description, const xml::Component& mod_x, SensitiveDetector& sens){
+static tuple<Volume, Position> build_specHomoCAL_module( Detector& description, const xml::Component& mod_x, SensitiveDetector& sens){
 
   double sx = mod_x.attr<double>(_Unicode(sizex));
   double sy = mod_x.attr<double>(_Unicode(sizey));
   double sz = mod_x.attr<double>(_Unicode(sizez));
   double frame_size = mod_x.attr<double>(_Unicode(frameSize));
 
-  Box    modShape( (sx/2.0 -frame_size) , (sy/2.0 -frame_size) , sz/2.0 );
   auto   modMat = description.material(mod_x.attr<std::string>(_Unicode(material)));
-  Volume modVol("module_vol", modShape, modMat);
+  string modVis = getAttrOrDefault<std::string>(mod_x, _Unicode(vis), "");
+  Volume modVol = epic::geo::sharedBox( description, "module_vol", (sx/2.0 -frame_size) , (sy/2.0 -frame_size) , sz/2.0,
+                                        modMat, modVis, sens );
 
-  if (mod_x.hasAttr(_Unicode(vis))) {
-    modVol.setVisAttributes(description.visAttributes(mod_x.attr<std::string>(_Unicode(vis))));
-  }
-
-  modVol.setSensitiveDetector(sens);
   return make_tuple(modVol, Position{sx, sy, sz} );
 }
 
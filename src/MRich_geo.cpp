@@ -17,6 +17,9 @@
 #include "TString.h"
 #include <XML/Helper.h>
 
+#include <array>
+#include <utility>
+
 using namespace std;
 using namespace dd4hep;
 using namespace dd4hep::rec;
@@ -329,7 +332,8 @@ static Ref_t createDetector(Detector& description, xml::Handle_t e, SensitiveDet
   auto points = epic::geo::fillSquares({0., 0.}, mod_width, rmin, rmax);
 
   // mod_name = ...
-  auto mod_v = modules[mod_name];
+  auto       mod_v     = modules[mod_name];
+  DetElement mod_proto = module_assembly_delements[mod_name];
 
   // read module positions
   std::vector<std::tuple<double, double, double>> positions;
@@ -341,15 +345,12 @@ static Ref_t createDetector(Detector& description, xml::Handle_t e, SensitiveDet
                                           x_positions.scale() * x_position.y() * mm, -x_positions.z0()));
     }
   }
-  // if no positions, then autoplacement
+  // if no positions, then autoplacement of whole modules in the first quadrant
   if (positions.empty()) {
-    for (double x = mod_width / 2.0; x < rmax - mod_width / 2.0; x += mod_width) {
-      for (double y = mod_width / 2.0; y < rmax - mod_width / 2.0; y += mod_width) {
-        if (pow(x + mod_width / 2.0, 2) + pow(y + mod_width / 2.0, 2) > rmax * rmax)
-          continue;
-        if (pow(x - mod_width / 2.0, 2) + pow(y - mod_width / 2.0, 2) < rmin * rmin)
-          continue;
-        positions.push_back(std::make_tuple(x, y, 0));
+    auto grid = epic::geo::squareGridInRing(mod_width, rmin, rmax, mod_width, true);
+    for (std::size_t i = 0; i < grid.size(); ++i) {
+      if (grid.col[i] >= 0 && grid.row[i] >= 0) {
+        positions.push_back(std::make_tuple(grid.x[i], grid.y[i], 0));
       }
     }
   }
@@ -364,15 +365,12 @@ static Ref_t createDetector(Detector& description, xml::Handle_t e, SensitiveDet
     double position_z0 = std::get<2>(position);
 
     // and place in all quadrants
-    for (auto& p : decltype(positions){{position_x, position_y, position_z0},
-                                       {position_y, -position_x, position_z0},
-                                       {-position_x, -position_y, position_z0},
-                                       {-position_y, position_x, position_z0}}) {
-
-      // get positions
-      double x  = std::get<0>(p);
-      double y  = std::get<1>(p);
-      double z0 = std::get<2>(p);
+    const std::array<std::pair<double, double>, 4> quadrants{{{position_x, position_y},
+                                                              {position_y, -position_x},
+                                                              {-position_x, -position_y},
+                                                              {-position_y, position_x}}};
+    for (const auto& [x, y] : quadrants) {
+      double z0 = position_z0;
 
       Transform3D tr;
       if (projective) {
@@ -387,9 +385,10 @@ static Ref_t createDetector(Detector& description, xml::Handle_t e, SensitiveDet
       pv = envVol.placeVolume(mod_v, tr);
       pv.addPhysVolID("module", i_mod);
 
-      auto mod_det_element = module_assembly_delements[mod_name].clone(mod_name + "__" + std::to_string(i_mod));
+      // placement-only module DetElement; the module components and their optical surfaces are
+      // described once by the module prototype, instead of a deep copy of its subtree per module
+      DetElement mod_det_element(sdet, mod_name + "__" + std::to_string(i_mod), mod_proto.id());
       mod_det_element.setPlacement(pv);
-      sdet.add(mod_det_element);
 
       i_mod++;
     }
@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 agent
+
+#include "MeshCache.h"
+#include "BinaryFile.h"
+#include "DD4hep/Primitives.h"
+#include "DD4hep/Printout.h"
+#include "TGeoTessellated.h"
+#include <cstdlib>
+
+namespace epic::geo {
+
+  // the cache is a host-local build product, written in native byte order
+  static constexpr const char*   mesh_cache_magic   = "EPICMSH";
+  static constexpr std::uint32_t mesh_cache_version = 1;
+
+  std::uint64_t fileHash(const std::string& path, const std::string& salt)
+  {
+    std::string buffer;
+    if (!readFile(path, buffer)) {
+      return 0;
+    }
+    return dd4hep::detail::hash64(salt + '\n' + buffer);
+  }
+
+  std::string meshCacheDirectory(const std::string& dir)
+  {
+    std::string result = dir;
+    if (!result.empty() && result[0] == '$') {
+      auto        end   = result.find('/');
+      std::string name  = result.substr(1, end == std::string::npos ? std::string::npos : end - 1);
+      const char* value = std::getenv(name.c_str());
+      if (value == nullptr || *value == '\0') {
+        return "";
+      }
+      result.replace(0, end == std::string::npos ? result.size() : end, value);
+    } else if (!result.empty() && result[0] != '/') {
+      const char* detector_path = std::getenv("DETECTOR_PATH");
+      if (detector_path == nullptr || *detector_path == '\0') {
+        return "";
+      }
+      result = std::string(detector_path) + "/" + result;
+    }
+    return result;
+  }
+
+  bool readMeshCache(const std::string& path, std::uint64_t key, MeshMap& meshes)
+  {
+    std::string buffer;
+    if (!readFile(path, buffer)) {
+      return false;
+    }
+
+    BufferReader     in(buffer);
+    BinaryFileHeader header;
+    std::uint32_t    nmeshes  = 0;
+    std::uint64_t    file_key = 0;
+    if (!in.read(header) || !checkBinaryFileHeader(header, mesh_cache_magic, mesh_cache_version) ||
+        !in.read(file_key) || file_key != key || !in.read(nmeshes)) {
+      dd4hep::printout(dd4hep::DEBUG, "MeshCache", "%s is not a mesh cache for key %016llx", path.c_str(),
+                       static_cast<unsigned long long>(key));
+      return false;
+    }
+
+    MeshMap result;
+    for (std::uint32_t i = 0; i < nmeshes; ++i) {
+      std::string name;
+      Mesh        mesh;
+      if (!in.read(name) || !in.read(mesh.vertices) || !in.read(mesh.facets)) {
+        dd4hep::printout(dd4hep::WARNING, "MeshCache", "truncated mesh cache %s, ignored", path.c_str());
+        return false;
+      }
+      result.emplace(std::move(name), std::move(mesh));
+    }
+    meshes = std::move(result);
+    return true;
+  }
+
+  bool writeMeshCache(const std::string& path, std::uint64_t key, const MeshMap& meshes)
+  {
+    BufferWriter out;
+    out.write(binaryFileHeader(mesh_cache_magic, mesh_cache_version));
+    out.write(key);
+    out.write(static_cast<std::uint32_t>(meshes.size()));
+    for (const auto& [name, mesh] : meshes) {
+      out.write(name);
+      out.write(mesh.vertices);
+      out.write(mesh.facets);
+    }
+    return writeFileAtomic(path, out.buffer());
+  }
+
+  bool meshFromSolid(dd4hep::TessellatedSolid solid, Mesh& mesh)
+  {
+    const TGeoTessellated* tess = solid.ptr();
+    mesh.vertices.resize(tess->GetNvertices());
+    for (int i = 0; i < tess->GetNvertices(); ++i) {
+      const auto& v    = tess->GetVertex(i);
+      mesh.vertices[i] = {v[0], v[1], v[2]};
+    }
+    mesh.facets.resize(tess->GetNfacets());
+    for (int i = 0; i < tess->GetNfacets(); ++i) {
+      const auto& facet = tess->GetFacet(i);
+      if (facet.GetNvert() != 3) {
+        return false;
+      }
+      mesh.facets[i] = {facet.GetVertexIndex(0), facet.GetVertexIndex(1), facet.GetVertexIndex(2)};
+    }
+    return true;
+  }
+
+  dd4hep::TessellatedSolid solidFromMesh(const std::string& name, const Mesh& mesh)
+  {
+    std::vector<TGeoTessellated::Vertex_t> vertices;
+    vertices.reserve(mesh.vertices.size());
+    for (const auto& v : mesh.vertices) {
+      vertices.emplace_back(v[0], v[1], v[2]);
+    }
+    dd4hep::TessellatedSolid solid(name, vertices);
+    for (const auto& f : mesh.facets) {
+      solid->AddFacet(f[0], f[1], f[2]);
+    }
+    // the facets were checked and oriented when the cache was written
+    solid->CloseShape(false, false, false);
+    return solid;
+  }
+
+} // namespace epic::geo
@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 agent
+
+#pragma once
+#include "DD4hep/Shapes.h"
+#include <array>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+// binary cache of closed tessellated solids, so that large meshes are not re-parsed and re-checked on every load
+namespace epic::geo {
+
+  /// Vertices and triangular facets of a closed tessellated solid
+  struct Mesh {
+    std::vector<std::array<double, 3>> vertices;
+    std::vector<std::array<int, 3>>    facets;
+  };
+
+  /// Meshes by solid name
+  using MeshMap = std::map<std::string, Mesh>;
+
+  /** Hash of the contents of a file, used as the key of a mesh cache.
+   *
+   * The salt is hashed with the contents, e.g. a version of the builder that turns the file into meshes,
+   * so that a builder change invalidates the cache. Returns 0 if the file cannot be read.
+   */
+  std::uint64_t fileHash(const std::string& path, const std::string& salt = "");
+
+  /** Directory of a mesh cache, from the mesh_cache attribute of a detector.
+   *
+   * A leading $VARIABLE is replaced by the value of the environment variable, and relative directories are
+   * taken relative to $DETECTOR_PATH, not to the working directory. Returns an empty string (no cache) if a
+   * variable is not set.
+   */
+  std::string meshCacheDirectory(const std::string& dir);
+
+  /** Read a mesh cache file in a single read.
+   *
+   * Returns false, leaving meshes untouched, if the file does not exist, is truncated,
+   * or was written for a different key or cache format.
+   */
+  bool readMeshCache(const std::string& path, std::uint64_t key, MeshMap& meshes);
+
+  /** Write a mesh cache file.
+   *
+   * The file is written under a unique temporary name and renamed, see writeFileAtomic().
+   * Returns false if the file cannot be written.
+   */
+  bool writeMeshCache(const std::string& path, std::uint64_t key, const MeshMap& meshes);
+
+  /// Extract the mesh of a closed tessellated solid, returns false if it has facets which are not triangles
+  bool meshFromSolid(dd4hep::TessellatedSolid solid, Mesh& mesh);
+
+  /// Build a tessellated solid from a cached mesh, without repeating the facet checks of a fresh solid
+  dd4hep::TessellatedSolid solidFromMesh(const std::string& name, const Mesh& mesh);
+
+} // namespace epic::geo
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 agent
+
+#include <DD4hep/DetFactoryHelper.h>
+#include <DD4hep/Factories.h>
+#include <DD4hep/Printout.h>
+
+#include "TGDMLMatrix.h"
+#include "TGeoManager.h"
+#include "TObjArray.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+using namespace dd4hep;
+
+namespace {
+
+  bool is_increasing(const TGDMLMatrix& m)
+  {
+    for (std::size_t r = 1; r < m.GetRows(); ++r) {
+      if (!(m.Get(r, 0) > m.Get(r - 1, 0))) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // linear interpolation of the table at energy e, as done by Geant4 for non-spline properties
+  double interpolate(const TGDMLMatrix& m, double e)
+  {
+    std::size_t r = 1;
+    while (r < m.GetRows() - 1 && m.Get(r, 0) < e) {
+      ++r;
+    }
+    double e0 = m.Get(r - 1, 0), e1 = m.Get(r, 0);
+    double f  = std::clamp((e - e0) / (e1 - e0), 0.0, 1.0);
+    return (1 - f) * m.Get(r - 1, 1) + f * m.Get(r, 1);
+  }
+
+  void resample_usage(int argc, char** argv)
+  {
+    std::cout << "Usage: -plugin <name> -arg [-arg]                                                  \n"
+                 "     name:   factory name     epic_ResampleOpticalProperties                       \n"
+                 "     step:<energy>            grid spacing, e.g. 0.1*eV (required)                 \n"
+                 "\tArguments given: "
+              << arguments(argc, argv) << std::endl;
+    std::exit(EINVAL);
+  }
+
+} // namespace
+
+/** Plugin to resample the optical property tables onto coarser uniform energy grids
+ *
+ * Tables of (energy, value) pairs are replaced in place by their linear interpolation on a uniform grid
+ * with the given step over the same energy range. Only tables which get fewer points are replaced, so
+ * this trades accuracy (knots and peaks finer than the step are lost) for smaller tables. Geant4 still
+ * builds free physics vectors from the tables, so the lookup remains a search, over fewer bins. Not run
+ * by default; bin/benchmark_optical_photons adds it to compare the simulation throughput.
+ */
+long resample_optical_properties(Detector& desc, int argc, char** argv)
+{
+  // argument parsing
+  double step = 0;
+  for (int i = 0; i < argc && argv[i]; ++i) {
+    if (0 == std::strncmp("step:", argv[i], 5))
+      step = _toDouble(argv[i] + 5);
+    else
+      resample_usage(argc, argv);
+  }
+  if (step <= 0) {
+    resample_usage(argc, argv);
+  }
+
+  TObjArray* matrices = desc.manager().GetListOfGDMLMatrices();
+  int        resampled = 0;
+  for (int i = 0; matrices != nullptr && i <= matrices->GetLast(); ++i) {
+    auto* m = dynamic_cast<TGDMLMatrix*>(matrices->At(i));
+    if (m == nullptr || m->GetCols() != 2 || m->GetRows() < 2) {
+      continue;
+    }
+    if (!is_increasing(*m)) {
+      printout(DEBUG, "OpticalProperties", "+++ %s: energies are not increasing, not resampled", m->GetName());
+      continue;
+    }
+    // never upsample: a table which would not get fewer points is left as it is
+    double      emin = m->Get(0, 0), emax = m->Get(m->GetRows() - 1, 0);
+    std::size_t rows = std::max<long>(std::lround((emax - emin) / step), 1) + 1;
+    if (rows >= m->GetRows()) {
+      continue;
+    }
+
+    TGDMLMatrix uniform(m->GetName(), rows, 2);
+    for (std::size_t r = 0; r < rows; ++r) {
+      double e = emin + r * (emax - emin) / (rows - 1);
+      uniform.Set(r, 0, e);
+      uniform.Set(r, 1, interpolate(*m, e));
+    }
+    printout(DEBUG, "OpticalProperties", "+++ %s: %zu points resampled to %zu uniform points",
+             m->GetName(), m->GetRows(), rows);
+    // assign in place, materials and surfaces refer to the table by name and handles keep their pointer
+    *m = uniform;
+    ++resampled;
+  }
+  printout(INFO, "OpticalProperties", "+++ Resampled %d optical property tables onto uniform grids with step %g eV",
+           resampled, step / dd4hep::eV);
+  return 1;
+}
+
+DECLARE_APPLY(epic_ResampleOpticalProperties, resample_optical_properties)
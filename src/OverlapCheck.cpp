@@ -0,0 +1,355 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 agent
+
+#include <DD4hep/DetFactoryHelper.h>
+#include <DD4hep/Factories.h>
+#include <DD4hep/Printout.h>
+#include <XML/DocumentHandler.h>
+
+#include "TGeoBBox.h"
+#include "TGeoManager.h"
+#include "TGeoMatrix.h"
+#include "TGeoNode.h"
+#include "TGeoVolume.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <fmt/core.h>
+
+using namespace dd4hep;
+
+namespace {
+
+  // a volume whose daughters are checked against each other and against the volume itself
+  struct CheckTask {
+    std::string detector;
+    TGeoVolume* volume;
+  };
+
+  // a daughter of a checked volume, daughters of assemblies are flattened into their mother
+  struct Daughter {
+    std::string      name;
+    const TGeoShape* shape;
+    TGeoHMatrix      matrix;       // daughter to mother frame
+    double           lo[3], hi[3]; // bounding box in the mother frame
+  };
+
+  struct Overlap {
+    std::string detector, mother, first, second; // second is empty for an extrusion from the mother
+    double      depth;
+
+    bool operator<(const Overlap& other) const
+    {
+      return std::tie(detector, mother, first, second) <
+             std::tie(other.detector, other.mother, other.first, other.second);
+    }
+  };
+
+  void add_daughters(TGeoVolume* volume, const TGeoHMatrix& matrix, const std::string& prefix,
+                     std::vector<Daughter>& daughters)
+  {
+    for (int i = 0; i < volume->GetNdaughters(); ++i) {
+      TGeoNode*   node = volume->GetNode(i);
+      TGeoHMatrix m    = matrix * TGeoHMatrix(*node->GetMatrix());
+      std::string name = prefix + node->GetName();
+      if (node->GetVolume()->IsAssembly()) {
+        add_daughters(node->GetVolume(), m, name + "/", daughters);
+        continue;
+      }
+      Daughter d{name, node->GetVolume()->GetShape(), m, {}, {}};
+      // bounding box of the transformed bounding box corners
+      const auto*   box     = static_cast<const TGeoBBox*>(d.shape);
+      const double* o       = box->GetOrigin();
+      double        half[3] = {box->GetDX(), box->GetDY(), box->GetDZ()};
+      std::fill(d.lo, d.lo + 3, std::numeric_limits<double>::max());
+      std::fill(d.hi, d.hi + 3, std::numeric_limits<double>::lowest());
+      for (int c = 0; c < 8; ++c) {
+        double local[3] = {o[0] + ((c & 1) ? half[0] : -half[0]), o[1] + ((c & 2) ? half[1] : -half[1]),
+                           o[2] + ((c & 4) ? half[2] : -half[2])};
+        double master[3];
+        d.matrix.LocalToMaster(local, master);
+        for (int k = 0; k < 3; ++k) {
+          d.lo[k] = std::min(d.lo[k], master[k]);
+          d.hi[k] = std::max(d.hi[k], master[k]);
+        }
+      }
+      daughters.push_back(std::move(d));
+    }
+  }
+
+  bool boxes_intersect(const Daughter& a, const Daughter& b)
+  {
+    for (int k = 0; k < 3; ++k) {
+      if (a.hi[k] < b.lo[k] || b.hi[k] < a.lo[k]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // daughters with intersecting bounding boxes, found by sweeping along x over the boxes sorted by their
+  // lower x edge, so only boxes which overlap in x are compared
+  std::vector<std::vector<std::size_t>> find_neighbours(const std::vector<Daughter>& daughters)
+  {
+    std::vector<std::size_t> order(daughters.size());
+    for (std::size_t i = 0; i < order.size(); ++i) {
+      order[i] = i;
+    }
+    std::sort(order.begin(), order.end(),
+              [&](std::size_t a, std::size_t b) { return daughters[a].lo[0] < daughters[b].lo[0]; });
+
+    std::vector<std::vector<std::size_t>> neighbours(daughters.size());
+    for (std::size_t a = 0; a < order.size(); ++a) {
+      const auto& d = daughters[order[a]];
+      for (std::size_t b = a + 1; b < order.size() && daughters[order[b]].lo[0] <= d.hi[0]; ++b) {
+        if (boxes_intersect(d, daughters[order[b]])) {
+          neighbours[order[a]].push_back(order[b]);
+          neighbours[order[b]].push_back(order[a]);
+        }
+      }
+    }
+    return neighbours;
+  }
+
+  // 64-bit FNV-1a hash, unlike std::hash the same with every standard library
+  std::uint64_t fnv1a(const std::string& text)
+  {
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : text) {
+      hash = (hash ^ c) * 1099511628211ULL;
+    }
+    return hash;
+  }
+
+  // Sample points inside every daughter and check that they are inside the mother and outside all other
+  // daughters, by more than the tolerance. The points are drawn from a generator seeded with a fixed hash
+  // of the volume name, so the result is reproducible.
+  std::vector<Overlap> check_volume(const CheckTask& task, int resolution, double tolerance)
+  {
+    std::vector<Daughter> daughters;
+    add_daughters(task.volume, TGeoHMatrix(), "", daughters);
+    const TGeoShape* mother = task.volume->IsAssembly() ? nullptr : task.volume->GetShape();
+
+    std::map<std::pair<std::size_t, std::size_t>, double> overlaps; // (daughter, daughter or npos) -> depth
+    std::mt19937_64 rng(fnv1a(task.volume->GetName()));
+    const auto      all_neighbours = find_neighbours(daughters);
+    for (std::size_t i = 0; i < daughters.size(); ++i) {
+      const auto& d          = daughters[i];
+      const auto& neighbours = all_neighbours[i];
+      if (mother == nullptr && neighbours.empty()) {
+        continue;
+      }
+
+      const auto*   box = static_cast<const TGeoBBox*>(d.shape);
+      const double* o   = box->GetOrigin();
+      std::uniform_real_distribution<double> x(o[0] - box->GetDX(), o[0] + box->GetDX());
+      std::uniform_real_distribution<double> y(o[1] - box->GetDY(), o[1] + box->GetDY());
+      std::uniform_real_distribution<double> z(o[2] - box->GetDZ(), o[2] + box->GetDZ());
+      int accepted = 0;
+      for (long attempt = 0; accepted < resolution && attempt < 20L * resolution; ++attempt) {
+        double local[3] = {x(rng), y(rng), z(rng)};
+        if (!d.shape->Contains(local)) {
+          continue;
+        }
+        ++accepted;
+        double master[3];
+        d.matrix.LocalToMaster(local, master);
+        if (mother != nullptr && !mother->Contains(master)) {
+          double depth = mother->Safety(master, kFALSE);
+          if (depth > tolerance) {
+            auto& max = overlaps[{i, std::string::npos}];
+            max       = std::max(max, depth);
+          }
+        }
+        for (auto j : neighbours) {
+          double other[3];
+          daughters[j].matrix.MasterToLocal(master, other);
+          if (daughters[j].shape->Contains(other)) {
+            double depth = daughters[j].shape->Safety(other, kTRUE);
+            if (depth > tolerance) {
+              auto& max = overlaps[{std::min(i, j), std::max(i, j)}];
+              max       = std::max(max, depth);
+            }
+          }
+        }
+      }
+    }
+
+    std::vector<Overlap> result;
+    for (const auto& [pair, depth] : overlaps) {
+      result.push_back({task.detector, task.volume->GetName(), daughters[pair.first].name,
+                        pair.second == std::string::npos ? "" : daughters[pair.second].name, depth});
+    }
+    return result;
+  }
+
+  // names of the detectors defined in compact files
+  std::set<std::string> detectors_in_files(const std::string& files)
+  {
+    std::set<std::string> names;
+    std::istringstream    in(files);
+    std::string           file;
+    while (std::getline(in, file, ',')) {
+      xml::DocumentHolder doc(xml::DocumentHandler().load(file));
+      for (xml_coll_t dets(doc.root(), _U(detectors)); dets; ++dets) {
+        for (xml_coll_t det(dets, _U(detector)); det; ++det) {
+          names.insert(xml_comp_t(det).nameStr());
+        }
+      }
+    }
+    return names;
+  }
+
+  void overlap_check_usage(int argc, char** argv)
+  {
+    std::cout << "Usage: -plugin <name> -arg [-arg]                                                  \n"
+                 "     name:   factory name     epic_OverlapCheck                                    \n"
+                 "     resolution:<number>      points sampled in each daughter (default: 10000)     \n"
+                 "     tolerance:<number>       minimum overlap depth in mm to report (default: 0.1) \n"
+                 "     threads:<number>         number of threads (default: hardware concurrency)    \n"
+                 "     detectors:<a,b,...>      only check these top-level detectors                 \n"
+                 "     changed:<a.xml,...>      only check the detectors defined in these files      \n"
+                 "     output:<string>          also write the report to this file                   \n"
+                 "\tArguments given: "
+              << arguments(argc, argv) << std::endl;
+    std::exit(EINVAL);
+  }
+
+} // namespace
+
+// Plugin to check for overlaps in each top-level detector independently and in parallel
+long check_overlaps(Detector& desc, int argc, char** argv)
+{
+  // argument parsing
+  int                   resolution = 10000;
+  double                tolerance  = 0.1 * dd4hep::mm;
+  int                   nthreads   = std::max(1u, std::thread::hardware_concurrency());
+  std::string           output;
+  std::set<std::string> selected;
+  bool                  select = false;
+  for (int i = 0; i < argc && argv[i]; ++i) {
+    if (0 == std::strncmp("resolution:", argv[i], 11))
+      resolution = std::atoi(argv[i] + 11);
+    else if (0 == std::strncmp("tolerance:", argv[i], 10))
+      tolerance = std::atof(argv[i] + 10) * dd4hep::mm;
+    else if (0 == std::strncmp("threads:", argv[i], 8))
+      nthreads = std::atoi(argv[i] + 8);
+    else if (0 == std::strncmp("detectors:", argv[i], 10)) {
+      std::istringstream in(argv[i] + 10);
+      for (std::string name; std::getline(in, name, ',');) {
+        selected.insert(name);
+      }
+      select = true;
+    } else if (0 == std::strncmp("changed:", argv[i], 8)) {
+      selected.merge(detectors_in_files(argv[i] + 8));
+      select = true;
+    } else if (0 == std::strncmp("output:", argv[i], 7))
+      output = (argv[i] + 7);
+    else
+      overlap_check_usage(argc, argv);
+  }
+  if (resolution < 1 || nthreads < 1) {
+    overlap_check_usage(argc, argv);
+  }
+
+  // One task per distinct volume with daughters, a volume placed many times is only checked once.
+  // Daughters of assemblies are checked in their first non-assembly mother. The world volume is always
+  // checked, with the top-level assemblies of the detectors flattened into it, so the detectors are also
+  // checked against each other and against the world.
+  std::vector<CheckTask>          tasks{{"world", desc.worldVolume().ptr()}};
+  std::unordered_set<TGeoVolume*> seen{desc.worldVolume().ptr()};
+  std::map<std::string, int>      volumes{{"world", 1}};
+  std::function<void(const std::string&, TGeoVolume*)> visit = [&](const std::string& det, TGeoVolume* vol) {
+    if (!seen.insert(vol).second || vol->GetNdaughters() == 0) {
+      return;
+    }
+    if (!vol->IsAssembly()) {
+      tasks.push_back({det, vol});
+      ++volumes[det];
+    }
+    for (int i = 0; i < vol->GetNdaughters(); ++i) {
+      visit(det, vol->GetNode(i)->GetVolume());
+    }
+  };
+  for (const auto& [name, det] : desc.world().children()) {
+    if (select && selected.count(name) == 0) {
+      continue;
+    }
+    visit(name, det.placement().volume().ptr());
+  }
+  printout(INFO, "OverlapCheck", "+++ Checking %zu volumes in %zu detectors with %d threads", tasks.size(),
+           volumes.size(), nthreads);
+
+  // shapes with per-thread state (e.g. boolean solids) look it up by the thread ID of the geometry manager,
+  // which every worker gets by creating its own navigator
+  TGeoManager&                      mgr = desc.manager();
+  std::vector<std::vector<Overlap>> results(tasks.size());
+  std::atomic_size_t                next{0};
+  auto                              worker = [&] {
+    mgr.AddNavigator();
+    for (std::size_t t = next++; t < tasks.size(); t = next++) {
+      results[t] = check_volume(tasks[t], resolution, tolerance);
+    }
+  };
+  mgr.SetMaxThreads(nthreads);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < nthreads; ++i) {
+    threads.emplace_back(worker);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  // drop the navigators of the workers and return the manager to single-threaded use
+  mgr.ClearThreadsMap();
+  mgr.SetMaxThreads(0);
+
+  // merge into one report, sorted so it does not depend on the scheduling
+  std::vector<Overlap> overlaps;
+  for (auto& r : results) {
+    overlaps.insert(overlaps.end(), r.begin(), r.end());
+  }
+  std::sort(overlaps.begin(), overlaps.end());
+  std::map<std::string, int> counts;
+  std::ostringstream         report;
+  for (const auto& o : overlaps) {
+    ++counts[o.detector];
+    if (o.second.empty()) {
+      report << fmt::format("{}: {} extrudes its mother {} by {:.3f} mm\n", o.detector, o.first, o.mother,
+                            o.depth / dd4hep::mm);
+    } else {
+      report << fmt::format("{}: {} and {} in {} overlap by {:.3f} mm\n", o.detector, o.first, o.second, o.mother,
+                            o.depth / dd4hep::mm);
+    }
+  }
+  for (const auto& [det, n] : volumes) {
+    report << fmt::format("{}: {} volumes checked, {} overlaps\n", det, n, counts[det]);
+  }
+  std::cout << report.str();
+  if (!output.empty()) {
+    std::ofstream(output) << report.str();
+  }
+  if (!overlaps.empty()) {
+    except("OverlapCheck", "+++ %zu overlaps found", overlaps.size());
+  }
+  return 1;
+}
+
+DECLARE_APPLY(epic_OverlapCheck, check_overlaps)
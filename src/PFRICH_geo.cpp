@@ -14,6 +14,9 @@
 
 #include <XML/Helper.h>
 
+#include "GeometryHelpers.h"
+#include "RICHGeometry.h"
+
 using namespace dd4hep;
 using namespace dd4hep::rec;
 
@@ -112,6 +115,10 @@ static Ref_t createDetector(Detector& desc, xml::Handle_t handle, SensitiveDetec
   for (const auto& idField : sensorIDfields)
     cellMask |= readoutCoder[idField].mask();
   desc.add(Constant("PFRICH_cell_mask", std::to_string(cellMask)));
+  // typed reconstruction parameters, alongside the string constants
+  auto* richGeo = new epic::geo::RICHGeometry();
+  det.addExtension<epic::geo::RICHGeometry>(richGeo);
+  richGeo->cell_mask = cellMask;
   // create a unique sensor ID from a sensor's PlacedVolume::volIDs
   auto encodeSensorID = [&readoutCoder](auto ids) {
     uint64_t enc = 0;
@@ -230,11 +237,16 @@ static Ref_t createDetector(Detector& desc, xml::Handle_t handle, SensitiveDetec
   double filterZpos  = vesselPos.z() + filterPV.position().z();
   desc.add(Constant("PFRICH_aerogel_zpos", std::to_string(aerogelZpos)));
   desc.add(Constant("PFRICH_filter_zpos", std::to_string(filterZpos)));
+  richGeo->aerogel.zpos = aerogelZpos;
+  richGeo->filter.zpos  = filterZpos;
 
   // radiator material names
   desc.add(Constant("PFRICH_aerogel_material", aerogelMat.ptr()->GetName(), "string"));
   desc.add(Constant("PFRICH_filter_material", filterMat.ptr()->GetName(), "string"));
   desc.add(Constant("PFRICH_gasvol_material", gasvolMat.ptr()->GetName(), "string"));
+  richGeo->aerogel.material = aerogelMat.ptr()->GetName();
+  richGeo->filter.material  = filterMat.ptr()->GetName();
+  richGeo->gasvol_material  = gasvolMat.ptr()->GetName();
 
   // BUILD SENSORS ///////////////////////
 
@@ -251,58 +263,50 @@ static Ref_t createDetector(Detector& desc, xml::Handle_t handle, SensitiveDetec
   // aerogel backplane (i.e., aerogel/filter boundary) and the sensor active surface (e.g, photocathode)
   double sensorZpos     = radiatorFrontplane - aerogelThickness - proximityGap - 0.5 * sensorThickness;
   auto   sensorPlanePos = Position(0., 0., sensorZpos) + originFront; // reference position
+  richGeo->sensor_plane_zpos = vesselPos.z() + sensorPlanePos.z() + 0.5 * sensorThickness;
   // miscellaneous
   int    imod    = 0;           // module number
   double tBoxMax = vesselRmax1; // sensors will be tiled in tBox, within annular limits
 
   // SENSOR MODULE LOOP ------------------------
-  /* cartesian tiling loop
-   * - start at (x=0,y=0), to center the grid
-   * - loop over positive-x positions; for each, place the corresponding negative-x sensor too
-   * - nested similar loop over y positions
+  /* cartesian tiling, centered at (x=0,y=0)
+   * - sensors are ordered by |x| column, +x before -x, then likewise by |y| row within a column, so
+   *   that the module numbers are stable
+   * - the row range of each column is computed from the annular limits, and the sensor centers from
+   *   their grid indices
    */
-  double sx, sy;
-  for (double usx = 0; usx <= tBoxMax; usx += sensorSide + sensorGap) {
-    for (int sgnx = 1; sgnx >= (usx > 0 ? -1 : 1); sgnx -= 2) {
-      for (double usy = 0; usy <= tBoxMax; usy += sensorSide + sensorGap) {
-        for (int sgny = 1; sgny >= (usy > 0 ? -1 : 1); sgny -= 2) {
-
-          // sensor (x,y) center
-          sx = sgnx * usx;
-          sy = sgny * usy;
-
-          // annular cut
-          if (std::hypot(sx, sy) < sensorPlaneRmin || std::hypot(sx, sy) > sensorPlaneRmax)
-            continue;
-
-          // placement (note: transformations are in reverse order)
-          auto sensorPlacement = Transform3D(
-              Translation3D(sensorPlanePos.x(), sensorPlanePos.y(), sensorPlanePos.z()) * // move to reference position
-              Translation3D(sx, sy, 0.)                                                   // move to grid position
-          );
-          auto sensorPV = gasvolVol.placeVolume(sensorVol, sensorPlacement);
-
-          // generate LUT for module number -> sensor position, for readout mapping tests
-          // printf("%d %f %f\n",imod,sensorPV.position().x(),sensorPV.position().y());
-
-          // properties
-          sensorPV.addPhysVolID("module", imod); // NOTE: must be consistent with `sensorIDfields`
-          auto       imodEnc = encodeSensorID(sensorPV.volIDs());
-          DetElement sensorDE(det, "sensor_de_" + std::to_string(imod), imodEnc);
-          sensorDE.setPlacement(sensorPV);
-          if (!debug_optics) {
-            SkinSurface sensorSkin(desc, sensorDE, "sensor_optical_surface_" + std::to_string(imod), sensorSurf,
-                                   sensorVol);
-            sensorSkin.isValid();
-          };
-
-          // increment sensor module number
-          imod++;
-        };
-      };
-    };
-  };
+  auto sensorGrid = epic::geo::squareGridInRing(sensorSide + sensorGap, sensorPlaneRmin, sensorPlaneRmax, 0., false,
+                                                tBoxMax);
+  for (std::size_t igrid = 0; igrid < sensorGrid.size(); ++igrid) {
+
+    // sensor (x,y) center
+    double sx = sensorGrid.x[igrid];
+    double sy = sensorGrid.y[igrid];
+
+    // placement (note: transformations are in reverse order)
+    auto sensorPlacement = Transform3D(
+        Translation3D(sensorPlanePos.x(), sensorPlanePos.y(), sensorPlanePos.z()) * // move to reference position
+        Translation3D(sx, sy, 0.)                                                   // move to grid position
+    );
+    auto sensorPV = gasvolVol.placeVolume(sensorVol, sensorPlacement);
+
+    // properties
+    sensorPV.addPhysVolID("module", imod); // NOTE: must be consistent with `sensorIDfields`
+    auto       imodEnc = encodeSensorID(sensorPV.volIDs());
+    DetElement sensorDE(det, "sensor_de_" + std::to_string(imod), imodEnc);
+    sensorDE.setPlacement(sensorPV);
+
+    // increment sensor module number
+    imod++;
+  }
   // END SENSOR MODULE LOOP ------------------------
+
+  // optical surface: a skin surface applies to every placement of the logical volume, so a single
+  // one for the shared sensor volume suffices, instead of one per sensor
+  if (!debug_optics) {
+    SkinSurface sensorSkin(desc, det, "sensor_optical_surface", sensorSurf, sensorVol);
+    sensorSkin.isValid();
+  }
   //
   // Add service material if desired
   if (detElem.child("sensors").hasChild(_Unicode(services))) {
@@ -18,6 +18,7 @@
 //
 //==========================================================================
 #include "DD4hep/DetFactoryHelper.h"
+#include "GeometryDetail.h"
 #include "XML/Layering.h"
 
 using namespace std;
@@ -41,6 +42,8 @@ static Ref_t create_detector(Detector& description, xml_h e, SensitiveDetector s
   double         totalThickness = layering.totalThickness();
   Volume         endcapVol("endcap", PolyhedraRegular(numsides, rmin, rmax, totalThickness), air);
   DetElement     endcap("endcap", det_id);
+  // homogenise each layer block (all repeats of a <layer>) into a single volume of the mixture
+  bool homogenize = dd4hep::getAttrOrDefault<bool>(x_det, _Unicode(homogenize), false);
 
   // std::cout << "totalThickness = " << totalThickness << "\n";
   // std::cout << "zmin = " << zmin << "\n";
@@ -59,8 +62,30 @@ static Ref_t create_detector(Detector& description, xml_h e, SensitiveDetector s
     xml_comp_t x_layer = xc;
     double     l_thick = layering.layer(l_num - 1)->thickness();
     // std::cout << "xc = " << xc << "\n";
-    string               l_name   = _toString(layerType, "layer%d");
-    int                  l_repeat = x_layer.repeat();
+    string l_name   = _toString(layerType, "layer%d");
+    int    l_repeat = x_layer.repeat();
+
+    if (homogenize) {
+      if (l_repeat <= 0)
+        throw std::runtime_error(x_det.nameStr() + "> Invalid repeat value");
+      auto   mix     = epic::geo::mixLayer(description, det_name + "_" + l_name + "_mix", x_layer, l_thick);
+      double b_thick = l_thick * l_repeat;
+      Volume b_vol(l_name, PolyhedraRegular(numsides, rmin, rmax, b_thick), mix.material);
+      b_vol.setVisAttributes(description.visAttributes(x_layer.visStr()));
+      if (mix.sensitive) {
+        sens.setType("calorimeter");
+        b_vol.setSensitiveDetector(sens);
+      }
+      DetElement   layer_elt(endcap, _toString(l_num, "layer%d"), l_num);
+      PlacedVolume pv = endcapVol.placeVolume(b_vol, Position(0, 0, layerZ + b_thick / 2));
+      pv.addPhysVolID("layer", l_num);
+      layer_elt.setPlacement(pv);
+      layerZ += b_thick;
+      l_num += l_repeat;
+      ++layerType;
+      continue;
+    }
+
     Volume               l_vol(l_name, PolyhedraRegular(numsides, rmin, rmax, l_thick), air);
     vector<PlacedVolume> sensitives;
 
@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 agent
+
+#pragma once
+#include <DD4hep/DetElement.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// reconstruction parameters of the RICH detectors, attached as an extension to their DetElements
+namespace epic::geo {
+
+  /** Typed RICH geometry parameters, in DD4hep units and global coordinates (w.r.t. the IP).
+   *
+   * Holds the same values as the <DET>_* string constants, without formatting and parsing them, e.g.
+   *   auto* geo = desc.detector("DRICH").extension<epic::geo::RICHGeometry>();
+   */
+  struct RICHGeometry {
+    using Vector = std::array<double, 3>;
+
+    RICHGeometry()                    = default;
+    RICHGeometry(const RICHGeometry&) = default;
+    /// Copy for a cloned detector element, as required of DetElement extensions
+    RICHGeometry(const RICHGeometry& other, dd4hep::DetElement /* de */) : RICHGeometry(other) {}
+
+    struct Sphere {
+      Vector center = {0, 0, 0};
+      double radius = 0;
+    };
+
+    /// Mirror and sensor spheres of one sector (dRICH only)
+    struct Sector {
+      Sphere mirror;
+      Sphere sensors;
+    };
+
+    /// Radiator plane: z position of the radiator centre, and its material
+    struct Radiator {
+      double      zpos = 0;
+      std::string material;
+    };
+
+    std::uint64_t       cell_mask = 0; // mask of the sensor ID fields in the cell ID
+    Radiator            aerogel;
+    Radiator            airgap; // dRICH only
+    Radiator            filter;
+    std::string         gasvol_material;
+    double              sensor_plane_zpos = 0; // z position of the sensor active surfaces (pfRICH only)
+    std::vector<Sector> sectors;
+  };
+
+} // namespace epic::geo
@@ -11,6 +11,7 @@
 //==========================================================================
 
 #include "DD4hep/DetFactoryHelper.h"
+#include "GeometryDetail.h"
 #include "GeometryHelpers.h"
 #include <XML/Helper.h>
 #include <algorithm>
@@ -129,51 +130,24 @@ std::tuple<Volume, Position> build_module(const Detector& desc, const xml::Compo
     Volume fiberVol("fiber_vol", fiberShape, fiberMat);
     fiberVol.setSensitiveDetector(sens);
 
-    // Fibers are placed in a honeycomb with the radius = sqrt(3)/2. * hexagon side length
-    // So each fiber is fully contained in a regular hexagon, which are placed as
-    //           ______________________________________
-    //           |          ____        ____          |
-    // even:     |         /    \      /    \         |
-    //           |    ____/      \____/      \____    |
-    //           |   /    \      /    \      /    \   |
-    // odd:      |  /      \____/      \____/      \  |
-    //           |  \      /    \      /    \      /  |
-    //           |   \____/      \____/      \____/   |
-    // even:     |        \      /    \      /        |
-    //           |         \____/      \____/      ___|___
-    //           |____________________________________|___offset
-    //                                              | |
-    //                                              |offset
+    // coarse detail level: fibers are only counted, the module becomes a homogeneous fiber/absorber mixture
+    bool coarse = epic::geo::isCoarse(desc);
+
+    // Fibers are placed in a honeycomb, see epic::geo::honeycombRectangle
     // the parameters space x and space y are used to add additional spaces between the hexagons
-    double fside  = 2. / std::sqrt(3.) * fr;
-    double fdistx = 2. * fside + fsx;
-    double fdisty = 2. * fr + fsy;
-
-    // maximum numbers of the fibers, help narrow the loop range
-    int nx = int(sx / (2. * fr)) + 1;
-    int ny = int(sy / (2. * fr)) + 1;
-
-    // std::cout << sx << ", " << sy << ", " << fr << ", " << nx << ", " << ny << std::endl;
-
-    // place the fibers
-    double y0      = (foff + fside);
-    int    nfibers = 0;
-    for (int iy = 0; iy < ny; ++iy) {
-      double y = y0 + fdisty * iy;
-      // about to touch the boundary
-      if ((sy - y) < y0) {
-        break;
-      }
-      double x0 = (iy % 2) ? (foff + fside) : (foff + fside + fdistx / 2.);
-      for (int ix = 0; ix < nx; ++ix) {
-        double x = x0 + fdistx * ix;
-        // about to touch the boundary
-        if ((sx - x) < x0) {
-          break;
-        }
-        auto fiberPV = modVol.placeVolume(fiberVol, nfibers++, Position{x - sx / 2., y - sy / 2., 0});
-        // std::cout << "(" << ix << ", " << iy << ", " << x - sx/2. << ", " << y - sy/2. << ", " << fr << "),\n";
-        fiberPV.addPhysVolID("fiber_x", ix + 1).addPhysVolID("fiber_y", iy + 1);
+    if (coarse) {
+      size_t nfibers    = epic::geo::honeycombRectangleCount(sx, sy, fr, fsx, fsy, foff);
+      double fiber_frac = nfibers * M_PI * fr * fr / (sx * sy);
+      modVol.setMaterial(epic::geo::mixMaterial(
+          desc, Form("%s_%s_ScFi%.6f", modMat.name(), fiberMat.name(), fiber_frac),
+          {{modMat, 1. - fiber_frac}, {fiberMat, fiber_frac}}));
+      modVol.setSensitiveDetector(sens);
+    } else {
+      // place the fibers
+      auto fibers = epic::geo::honeycombRectangle(sx, sy, fr, fsx, fsy, foff);
+      for (size_t i = 0; i < fibers.size(); ++i) {
+        auto fiberPV = modVol.placeVolume(fiberVol, i, Position{fibers.x[i], fibers.y[i], 0});
+        fiberPV.addPhysVolID("fiber_x", fibers.col[i] + 1).addPhysVolID("fiber_y", fibers.row[i] + 1);
       }
     }
     // if no fibers we make the module itself sensitive
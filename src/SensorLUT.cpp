@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 agent
+
+#include <DD4hep/DetFactoryHelper.h>
+#include <DD4hep/Factories.h>
+#include <DD4hep/Printout.h>
+
+#include "TGeoMatrix.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "BinaryFile.h"
+#include "SensorLUT.h"
+
+using namespace dd4hep;
+
+namespace {
+
+  // lookup table entry for a sensor detector element, from its nominal global placement
+  epic::geo::SensorLUTEntry sensor_entry(DetElement sensor)
+  {
+    const TGeoHMatrix& transform = sensor.nominal().worldTransformation();
+    const double       origin[3] = {0, 0, 0};
+    const double       x[3] = {1, 0, 0}, y[3] = {0, 1, 0}, z[3] = {0, 0, 1};
+
+    epic::geo::SensorLUTEntry entry;
+    entry.id = sensor.id();
+    transform.LocalToMaster(origin, entry.center);
+    transform.LocalToMasterVect(x, entry.u);
+    transform.LocalToMasterVect(y, entry.v);
+    transform.LocalToMasterVect(z, entry.normal);
+    for (auto& c : entry.center) {
+      c /= dd4hep::mm;
+    }
+    return entry;
+  }
+
+  // collect the sensor detector elements ("sensor_de_*") below a detector element
+  void collect(DetElement de, std::vector<epic::geo::SensorLUTEntry>& entries)
+  {
+    for (const auto& [name, child] : de.children()) {
+      if (name.compare(0, 10, "sensor_de_") == 0) {
+        entries.push_back(sensor_entry(child));
+      } else {
+        collect(child, entries);
+      }
+    }
+  }
+
+  void sensor_lut_usage(int argc, char** argv)
+  {
+    std::cout << "Usage: -plugin <name> -arg [-arg]                                                  \n"
+                 "     name:   factory name     epic_SensorLUT                                       \n"
+                 "     detector:<string>        detector to write the table of, may be repeated      \n"
+                 "     output:<string>          output directory (default: .)                        \n"
+                 "\tArguments given: "
+              << arguments(argc, argv) << std::endl;
+    std::exit(EINVAL);
+  }
+
+} // namespace
+
+// Plugin to write the sensor lookup tables <output>/<detector>_sensors.lut of the RICH detectors
+long write_sensor_lut(Detector& desc, int argc, char** argv)
+{
+  // argument parsing
+  std::vector<std::string> detectors;
+  std::string              output = ".";
+  for (int i = 0; i < argc && argv[i]; ++i) {
+    if (0 == std::strncmp("detector:", argv[i], 9))
+      detectors.emplace_back(argv[i] + 9);
+    else if (0 == std::strncmp("output:", argv[i], 7))
+      output = (argv[i] + 7);
+    else
+      sensor_lut_usage(argc, argv);
+  }
+  if (detectors.empty() || output.empty()) {
+    sensor_lut_usage(argc, argv);
+  }
+
+  for (const auto& name : detectors) {
+    std::vector<epic::geo::SensorLUTEntry> entries;
+    collect(desc.detector(name), entries);
+    if (entries.empty()) {
+      except("SensorLUT", "+++ No sensors in detector %s", name.c_str());
+    }
+    std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) { return a.id < b.id; });
+
+    epic::geo::SensorLUTHeader header{};
+    header.file       = epic::geo::binaryFileHeader(epic::geo::sensor_lut_magic, epic::geo::sensor_lut_version);
+    header.entry_size = sizeof(epic::geo::SensorLUTEntry);
+    header.count      = entries.size();
+
+    epic::geo::BufferWriter writer;
+    writer.write(header);
+    writer.write(entries.data(), entries.size() * sizeof(epic::geo::SensorLUTEntry));
+    std::string path = output + "/" + name + "_sensors.lut";
+    if (!epic::geo::writeFileAtomic(path, writer.buffer())) {
+      except("SensorLUT", "+++ Failed to write %s", path.c_str());
+    }
+    printout(INFO, "SensorLUT", "+++ Wrote %zu sensors of %s to %s", entries.size(), name.c_str(), path.c_str());
+  }
+  return 1;
+}
+
+DECLARE_APPLY(epic_SensorLUT, write_sensor_lut)
@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 agent
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "BinaryFile.h"
+
+/* binary lookup table of sensor positions, so that reconstruction can map a sensor ID to its position
+ * with a binary search instead of navigating the geometry
+ *
+ * The tables are written by the epic_SensorLUT plugin, e.g.
+ *   geoPluginRun -input epic_drich_only.xml -plugin epic_SensorLUT -arg detector:DRICH -arg output:calibrations
+ * and are read with SensorLUT, which only needs this header and BinaryFile.h.
+ *
+ * File layout, in native byte order:
+ * - header (32 bytes): BinaryFileHeader with magic "EPICLUT", uint32 entry size, uint32 reserved,
+ *   uint64 number of entries
+ * - entries (SensorLUTEntry), sorted by sensor ID, so the file can be mapped into memory and searched
+ */
+namespace epic::geo {
+
+  inline constexpr const char*   sensor_lut_magic   = "EPICLUT";
+  inline constexpr std::uint32_t sensor_lut_version = 1;
+
+  /// Position and orientation of one sensor in global coordinates, lengths in mm
+  struct SensorLUTEntry {
+    std::uint64_t id;        // encoded sensor ID
+    double        center[3]; // sensor centre
+    double        normal[3]; // unit normal, along the local z axis of the sensor
+    double        u[3];      // unit vector along the local x axis of the sensor
+    double        v[3];      // unit vector along the local y axis of the sensor
+  };
+  static_assert(sizeof(SensorLUTEntry) == 104, "SensorLUTEntry must not be padded");
+
+  struct SensorLUTHeader {
+    BinaryFileHeader file;
+    std::uint32_t    entry_size;
+    std::uint32_t    reserved;
+    std::uint64_t    count;
+  };
+  static_assert(sizeof(SensorLUTHeader) == 32, "SensorLUTHeader must not be padded");
+
+  /// Read-only view of a sensor lookup table file, mapped into memory
+  class SensorLUT {
+  public:
+    SensorLUT() = default;
+    SensorLUT(const SensorLUT&) = delete;
+    SensorLUT& operator=(const SensorLUT&) = delete;
+    ~SensorLUT() { close(); }
+
+    /** Map a sensor lookup table file.
+     *
+     * Returns false, leaving the table empty, if the file does not exist, is truncated, or has a different
+     * format, version or byte order.
+     */
+    bool open(const std::string& path)
+    {
+      close();
+      int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+      if (fd < 0) {
+        return false;
+      }
+      struct stat st;
+      if (::fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(SensorLUTHeader)) {
+        ::close(fd);
+        return false;
+      }
+      void* data = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      ::close(fd);
+      if (data == MAP_FAILED) {
+        return false;
+      }
+      const auto* header = static_cast<const SensorLUTHeader*>(data);
+      std::size_t size   = st.st_size;
+      if (!checkBinaryFileHeader(header->file, sensor_lut_magic, sensor_lut_version) ||
+          header->entry_size != sizeof(SensorLUTEntry) ||
+          header->count != (size - sizeof(SensorLUTHeader)) / sizeof(SensorLUTEntry) ||
+          (size - sizeof(SensorLUTHeader)) % sizeof(SensorLUTEntry) != 0) {
+        ::munmap(data, size);
+        return false;
+      }
+      m_data    = data;
+      m_size    = size;
+      m_entries = reinterpret_cast<const SensorLUTEntry*>(header + 1);
+      m_count   = header->count;
+      return true;
+    }
+
+    void close()
+    {
+      if (m_data != nullptr) {
+        ::munmap(m_data, m_size);
+      }
+      m_data    = nullptr;
+      m_size    = 0;
+      m_entries = nullptr;
+      m_count   = 0;
+    }
+
+    /// Entry of a sensor, or nullptr if the sensor is not in the table
+    const SensorLUTEntry* find(std::uint64_t id) const
+    {
+      const SensorLUTEntry* it =
+          std::lower_bound(begin(), end(), id, [](const SensorLUTEntry& e, std::uint64_t i) { return e.id < i; });
+      return it != end() && it->id == id ? it : nullptr;
+    }
+
+    const SensorLUTEntry* begin() const { return m_entries; }
+    const SensorLUTEntry* end() const { return m_entries + m_count; }
+    std::size_t           size() const { return m_count; }
+
+  private:
+    void*                 m_data    = nullptr;
+    std::size_t           m_size    = 0;
+    const SensorLUTEntry* m_entries = nullptr;
+    std::size_t           m_count   = 0;
+  };
+
+} // namespace epic::geo
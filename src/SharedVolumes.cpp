@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 agent
+
+#include "SharedVolumes.h"
+#include "DD4hep/Printout.h"
+#include "DD4hep/Shapes.h"
+#include <fmt/core.h>
+#include <unordered_map>
+
+namespace epic::geo {
+
+  // shared volumes of one detector description, attached to it as an extension
+  struct SharedVolumeRegistry {
+    std::unordered_map<std::string, dd4hep::Volume> volumes;
+  };
+
+  static SharedVolumeRegistry& registry(dd4hep::Detector& desc)
+  {
+    auto reg = desc.extension<SharedVolumeRegistry>(false);
+    if (reg == nullptr) {
+      reg = desc.addExtension<SharedVolumeRegistry>(new SharedVolumeRegistry);
+    }
+    return *reg;
+  }
+
+  // look up the volume with this key, or build and register it
+  template <typename BuildShape>
+  static dd4hep::Volume shared_volume(dd4hep::Detector& desc, const std::string& shape_key, const std::string& name,
+                                      BuildShape build_shape, dd4hep::Material mat, const std::string& vis,
+                                      dd4hep::SensitiveDetector sens)
+  {
+    // shortest round-trip representation of the parameters, so only identical values share a volume
+    std::string key = fmt::format("{}|{}|{}|{}", shape_key, mat.name(), vis, sens.isValid() ? sens.name() : "");
+
+    auto& volumes = registry(desc).volumes;
+    auto  it      = volumes.find(key);
+    if (it != volumes.end()) {
+      return it->second;
+    }
+
+    dd4hep::Volume vol(name, build_shape(), mat);
+    if (!vis.empty()) {
+      vol.setVisAttributes(desc.visAttributes(vis));
+    }
+    if (sens.isValid()) {
+      vol.setSensitiveDetector(sens);
+    }
+    volumes.emplace(key, vol);
+    dd4hep::printout(dd4hep::DEBUG, "SharedVolumes", "built shared volume %s for %s", name.c_str(), key.c_str());
+    return vol;
+  }
+
+  dd4hep::Volume sharedBox(dd4hep::Detector& desc, const std::string& name, double dx, double dy, double dz,
+                           dd4hep::Material mat, const std::string& vis, dd4hep::SensitiveDetector sens)
+  {
+    return shared_volume(
+        desc, fmt::format("box|{}|{}|{}", dx, dy, dz), name, [&]() { return dd4hep::Box(dx, dy, dz); }, mat, vis,
+        sens);
+  }
+
+  dd4hep::Volume sharedTube(dd4hep::Detector& desc, const std::string& name, double rmin, double rmax, double dz,
+                            dd4hep::Material mat, const std::string& vis, dd4hep::SensitiveDetector sens)
+  {
+    return shared_volume(
+        desc, fmt::format("tube|{}|{}|{}", rmin, rmax, dz), name, [&]() { return dd4hep::Tube(rmin, rmax, dz); },
+        mat, vis, sens);
+  }
+
+  std::size_t sharedVolumeCount(const dd4hep::Detector& desc)
+  {
+    auto reg = desc.extension<SharedVolumeRegistry>(false);
+    return reg == nullptr ? 0 : reg->volumes.size();
+  }
+
+} // namespace epic::geo
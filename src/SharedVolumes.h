@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 agent
+
+#pragma once
+#include "DD4hep/Detector.h"
+#include "DD4hep/Objects.h"
+#include "DD4hep/Volumes.h"
+#include <cstddef>
+#include <string>
+
+// registry of simple leaf volumes shared by the detector builders
+namespace epic::geo {
+
+  /** Get a box volume shared by all callers that ask for the same box.
+   *
+   * The volume is looked up by its half-lengths, material, visualization attributes and sensitive detector,
+   * and is only built on the first request. The registry lives as long as the detector description.
+   * Shared volumes are leaves: callers must not place daughters in them or change their attributes.
+   *
+   * @param name  name of the volume, only used when the volume is built
+   * @param vis   name of the visualization attributes, empty for none
+   * @param sens  sensitive detector, invalid handle for a passive volume
+   */
+  dd4hep::Volume sharedBox(dd4hep::Detector& desc, const std::string& name, double dx, double dy, double dz,
+                           dd4hep::Material mat, const std::string& vis = "",
+                           dd4hep::SensitiveDetector sens = dd4hep::SensitiveDetector());
+
+  /// Get a tube volume shared by all callers that ask for the same tube, see sharedBox()
+  dd4hep::Volume sharedTube(dd4hep::Detector& desc, const std::string& name, double rmin, double rmax, double dz,
+                            dd4hep::Material mat, const std::string& vis = "",
+                            dd4hep::SensitiveDetector sens = dd4hep::SensitiveDetector());
+
+  /// Number of volumes in the registry of this detector description
+  std::size_t sharedVolumeCount(const dd4hep::Detector& desc);
+
+} // namespace epic::geo
@@ -10,6 +10,7 @@
 //==========================================================================
 
 #include "DD4hep/DetFactoryHelper.h"
+#include "GeometryDetail.h"
 #include "GeometryHelpers.h"
 #include <XML/Helper.h>
 #include <XML/Layering.h>
@@ -66,7 +67,8 @@ static Ref_t create_detector(Detector& desc, xml::Handle_t handle, SensitiveDete
 }
 
 // helper function to build module with or w/o wrapper
-std::tuple<Volume, int, double, double> build_shashlik(Detector& desc, xml::Collection_t& plm, SensitiveDetector& sens)
+std::tuple<Volume, int, double, double> build_shashlik(Detector& desc, xml::Collection_t& plm, SensitiveDetector& sens,
+                                                       const std::string& prefix)
 {
   auto mod = plm.child(_Unicode(module));
   // a modular volume
@@ -102,12 +104,35 @@ std::tuple<Volume, int, double, double> build_shashlik(Detector& desc, xml::Coll
     }
   }
 
+  // homogenise each set of layers (all repeats of a <layer>) into a single volume of the mixture
+  bool homogenize = dd4hep::getAttrOrDefault<bool>(mod, _Unicode(homogenize), false);
+
   // layer start point
   double lz   = -len / 2.;
   int    lnum = 1;
   // Loop over the sets of layer elements in the detector.
   for (xml_coll_t li(mod, _U(layer)); li; ++li) {
     int repeat = li.attr<int>(_Unicode(repeat));
+    if (homogenize) {
+      std::string      lname  = Form("layer%d", lnum);
+      double           lthick = layering.layer(lnum - 1)->thickness() * repeat;
+      auto             mix    = epic::geo::mixLayer(desc, prefix + "_" + lname + "_mix", li);
+      PolyhedraRegular lpoly(nsides, 0., rmax, lthick);
+      Volume           lvol(lname, lpoly, mix.material);
+      if (mix.sensitive) {
+        lvol.setSensitiveDetector(sens);
+      }
+      lvol.setAttributes(desc, dd4hep::getAttrOrDefault<std::string>(li, _Unicode(region), ""),
+                         dd4hep::getAttrOrDefault<std::string>(li, _Unicode(limits), ""),
+                         dd4hep::getAttrOrDefault<std::string>(li, _Unicode(vis), "InvisibleNoDaughters"));
+
+      // the set is identified by the number of its first layer
+      auto layerPV = mvol.placeVolume(lvol, Position(0, 0, lz + lthick / 2));
+      layerPV.addPhysVolID("layer", lnum);
+      lnum += repeat;
+      lz += lthick;
+      continue;
+    }
     // Loop over number of repeats for this layer.
     for (int j = 0; j < repeat; j++) {
       std::string      lname  = Form("layer%d", lnum);
@@ -162,8 +187,8 @@ std::tuple<Volume, int, double, double> build_shashlik(Detector& desc, xml::Coll
 // place disk of modules
 static void add_disk_shashlik(Detector& desc, Assembly& env, xml::Collection_t& plm, SensitiveDetector& sens, int sid)
 {
-  auto [mvol, nsides, sidelen, len] = build_shashlik(desc, plm, sens);
   int    sector_id                  = dd4hep::getAttrOrDefault<int>(plm, _Unicode(sector), sid);
+  auto [mvol, nsides, sidelen, len] = build_shashlik(desc, plm, sens, Form("%s_sector%d", env.name(), sector_id));
   int    id_begin                   = dd4hep::getAttrOrDefault<int>(plm, _Unicode(id_begin), 1);
   double rmin                       = plm.attr<double>(_Unicode(rmin));
   double rmax                       = plm.attr<double>(_Unicode(rmax));
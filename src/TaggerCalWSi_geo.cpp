@@ -6,6 +6,7 @@
 #include "DD4hep/Printout.h"
 #include "DDRec/DetectorData.h"
 #include "DDRec/Surface.h"
+#include "SharedVolumes.h"
 #include <XML/Helper.h>
 
 //////////////////////////////////////////////////
@@ -48,17 +49,12 @@ static Ref_t createDetector(Detector& desc, xml_h e, SensitiveDetector sens)
   for (int i = 0; i < 20; i++) {
 
     // absorber
-    Box    Abso_Box(Width, Height, abso_z / 2);
-    Volume absoVol("AbsorberVolume", Abso_Box, Absorber);
-    absoVol.setVisAttributes(desc.visAttributes("BlueVis"));
+    Volume absoVol = epic::geo::sharedBox(desc, "AbsorberVolume", Width, Height, abso_z / 2, Absorber, "BlueVis");
 
     detVol.placeVolume(absoVol, Position(0, 0, Thickness - (i) * (abso_z + sens_z) - abso_z / 2));
 
     // sensitive layer
-    Box    Cal_Box(Width, Height, sens_z / 2);
-    Volume calVol("SensVolume", Cal_Box, Silicon);
-    calVol.setSensitiveDetector(sens);
-    calVol.setVisAttributes(desc.visAttributes("RedVis"));
+    Volume calVol = epic::geo::sharedBox(desc, "SensVolume", Width, Height, sens_z / 2, Silicon, "RedVis", sens);
 
     PlacedVolume pv_mod =
         detVol.placeVolume(calVol, Position(0, 0, Thickness - (i) * (abso_z + sens_z) - abso_z - sens_z / 2));
@@ -58,7 +58,7 @@ static Ref_t create_detector(Detector& description, xml_h e, SensitiveDetector s
   // Add the volume boundary material if configured
   for (xml_coll_t bmat(x_det, _Unicode(boundary_material)); bmat; ++bmat) {
     xml_comp_t x_boundary_material = bmat;
-    DD4hepDetectorHelper::xmlToProtoSurfaceMaterial(x_boundary_material, params,
+    DD4hepDetectorHelper::xmlToProtoSurfaceMaterial(x_boundary_material, sdet, params,
                                          "boundary_material");
   }
 
@@ -202,6 +202,18 @@ static Ref_t create_detector(Detector& description, xml_h e, SensitiveDetector s
     modules[m_nam] = m_volume;
   }
 
+  // the sensor parameters are the same for all modules: the first sensor owns them, the others share them,
+  // just like the measurement planes are shared by all sensors of a module type
+  dd4hep::rec::VariantParameters* sensor_params   = nullptr;
+  auto                            addSensorParams = [&sensor_params](DetElement& comp_elt) {
+    if (sensor_params == nullptr) {
+      sensor_params = &DD4hepDetectorHelper::ensureExtension<dd4hep::rec::VariantParameters>(comp_elt);
+      sensor_params->set<string>("axis_definitions", "XZY");
+    } else {
+      DD4hepDetectorHelper::shareExtension(comp_elt, *sensor_params);
+    }
+  };
+
   for (xml_coll_t li(x_det, _U(layer)); li; ++li) {
     xml_comp_t x_layer(li);
     int        l_id    = x_layer.id();
@@ -246,21 +258,23 @@ static Ref_t create_detector(Detector& description, xml_h e, SensitiveDetector s
 
     for (xml_coll_t lmat(x_layer, _Unicode(layer_material)); lmat; ++lmat) {
       xml_comp_t x_layer_material = lmat;
-      DD4hepDetectorHelper::xmlToProtoSurfaceMaterial(x_layer_material, layerParams, "layer_material");
+      DD4hepDetectorHelper::xmlToProtoSurfaceMaterial(x_layer_material, layer_element, layerParams,
+                                                      "layer_material");
     }
 
     for (xml_coll_t ri(x_layer, _U(ring)); ri; ++ri) {
-      xml_comp_t  x_ring   = ri;
-      double      r        = x_ring.r();
-      double      phi0     = x_ring.phi0(0);
-      double      zstart   = x_ring.zstart();
-      double      dz       = x_ring.dz(0);
-      int         nmodules = x_ring.nmodules();
-      string      m_nam    = x_ring.moduleStr();
-      Volume      m_vol    = modules[m_nam];
-      double      iphi     = 2 * M_PI / nmodules;
-      double      phi      = phi0;
-      Placements& sensVols = sensitives[m_nam];
+      xml_comp_t  x_ring    = ri;
+      double      r         = x_ring.r();
+      double      phi0      = x_ring.phi0(0);
+      double      zstart    = x_ring.zstart();
+      double      dz        = x_ring.dz(0);
+      int         nmodules  = x_ring.nmodules();
+      string      m_nam     = x_ring.moduleStr();
+      Volume      m_vol     = modules[m_nam];
+      double      iphi      = 2 * M_PI / nmodules;
+      double      phi       = phi0;
+      Placements& sensVols  = sensitives[m_nam];
+      auto&       sensSurfs = volplane_surfaces[m_nam];
 
       for (int k = 0; k < nmodules; ++k) {
         string m_base = _toString(l_id, "layer%d") + _toString(mod_num, "_module%d");
@@ -276,10 +290,9 @@ static Ref_t create_detector(Detector& description, xml_h e, SensitiveDetector s
           for (size_t ic = 0; ic < sensVols.size(); ++ic) {
             PlacedVolume sens_pv = sensVols[ic];
             DetElement   comp_elt(module, sens_pv.volume().name(), mod_num);
-            auto &params = DD4hepDetectorHelper::ensureExtension<dd4hep::rec::VariantParameters>(comp_elt);
-            params.set<string>("axis_definitions", "XZY");
+            addSensorParams(comp_elt);
             comp_elt.setPlacement(sens_pv);
-            volSurfaceList(comp_elt)->push_back(volplane_surfaces[m_nam][ic]);
+            volSurfaceList(comp_elt)->push_back(sensSurfs[ic]);
           }
         } else {
           pv = layer_vol.placeVolume(
@@ -290,10 +303,9 @@ static Ref_t create_detector(Detector& description, xml_h e, SensitiveDetector s
           for (size_t ic = 0; ic < sensVols.size(); ++ic) {
             PlacedVolume sens_pv = sensVols[ic];
             DetElement   comp_elt(r_module, sens_pv.volume().name(), mod_num);
-            auto &params = DD4hepDetectorHelper::ensureExtension<dd4hep::rec::VariantParameters>(comp_elt);
-            params.set<string>("axis_definitions", "XZY");
+            addSensorParams(comp_elt);
             comp_elt.setPlacement(sens_pv);
-            volSurfaceList(comp_elt)->push_back(volplane_surfaces[m_nam][ic]);
+            volSurfaceList(comp_elt)->push_back(sensSurfs[ic]);
           }
         }
         dz = -dz;
@@ -6,6 +6,7 @@
 #include "DD4hep/Printout.h"
 #include "DDRec/DetectorData.h"
 #include "DDRec/Surface.h"
+#include "SharedVolumes.h"
 #include <XML/Helper.h>
 #include <algorithm>
 #include <iostream>
@@ -63,11 +64,8 @@ static Ref_t create_detector(Detector& desc, xml_h handle, SensitiveDetector sen
   Material   t_mat  = desc.material(twr.materialStr());
   string     t_name = twr.nameStr();
 
-  Box    t_Shape(tsx / 2., tsy / 2., tsz / 2.);
-  Volume t_Vol("tower_vol", t_Shape, t_mat);
-  t_Vol.setVisAttributes(desc.visAttributes(twr.visStr()));
-  if (twr.isSensitive())
-    t_Vol.setSensitiveDetector(sens);
+  Volume t_Vol = epic::geo::sharedBox(desc, "tower_vol", tsx / 2., tsy / 2., tsz / 2., t_mat, twr.visStr(),
+                                      twr.isSensitive() ? sens : SensitiveDetector());
 
   // readout socket
   xml_comp_t sct    = mod_x.child(_Unicode(socket));
@@ -77,9 +75,7 @@ static Ref_t create_detector(Detector& desc, xml_h handle, SensitiveDetector sen
   Material   s_mat  = desc.material(sct.materialStr());
   string     s_name = sct.nameStr();
 
-  Box    s_Shape(ssx / 2., ssy / 2., ssz / 2.);
-  Volume s_Vol("socket_vol", s_Shape, s_mat);
-  s_Vol.setVisAttributes(desc.visAttributes(sct.visStr()));
+  Volume s_Vol = epic::geo::sharedBox(desc, "socket_vol", ssx / 2., ssy / 2., ssz / 2., s_mat, sct.visStr());
 
   PlacedVolume pv;
   double       x_pos_0          = -(nx * tsx + (nx - 1) * fthickness) / 2.;
@@ -6,6 +6,7 @@
 #include "DD4hep/Printout.h"
 #include "DDRec/DetectorData.h"
 #include "DDRec/Surface.h"
+#include "SharedVolumes.h"
 #include <XML/Helper.h>
 #include <algorithm>
 #include <iostream>
@@ -60,11 +61,8 @@ static Ref_t create_detector(Detector& desc, xml_h handle, SensitiveDetector sen
       string     sl_name = x_sl.nameStr();
       double     sl_z    = x_sl.thickness();
 
-      Box    sl_Shape(xwidth / 2., ywidth / 2., sl_z / 2.);
-      Volume sl_Vol("slice_vol", sl_Shape, sl_mat);
-      sl_Vol.setVisAttributes(desc.visAttributes(x_sl.visStr()));
-      if (x_sl.isSensitive())
-        sl_Vol.setSensitiveDetector(sens);
+      Volume sl_Vol = epic::geo::sharedBox(desc, "slice_vol", xwidth / 2., ywidth / 2., sl_z / 2., sl_mat,
+                                           x_sl.visStr(), x_sl.isSensitive() ? sens : SensitiveDetector());
 
       nsl++;
       v_sl_name[nsl]        = sl_name;
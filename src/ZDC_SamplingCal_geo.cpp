@@ -6,6 +6,8 @@
 #include "DD4hep/Printout.h"
 #include "DDRec/DetectorData.h"
 #include "DDRec/Surface.h"
+#include "GeometryDetail.h"
+#include "SharedVolumes.h"
 #include <XML/Helper.h>
 #include <algorithm>
 #include <iostream>
@@ -49,6 +51,7 @@ static Ref_t create_detector(Detector& desc, xml_h handle, SensitiveDetector sen
   map<int, string>    v_sl_name;
   map<string, Volume> slices;
   map<string, double> sl_thickness;
+  vector<string>      sens_sl_names;
 
   int        nsl = 0;
   xml_coll_t ci(x_lyr, _Unicode(slice));
@@ -58,11 +61,11 @@ static Ref_t create_detector(Detector& desc, xml_h handle, SensitiveDetector sen
     string     sl_name = x_sl.nameStr();
     double     sl_z    = x_sl.thickness();
 
-    Box    sl_Shape(xwidth / 2., ywidth / 2., sl_z / 2.);
-    Volume sl_Vol("slice_vol", sl_Shape, sl_mat);
-    sl_Vol.setVisAttributes(desc.visAttributes(x_sl.visStr()));
-    if (x_sl.isSensitive())
-      sl_Vol.setSensitiveDetector(sens);
+    Volume sl_Vol = epic::geo::sharedBox(desc, "slice_vol", xwidth / 2., ywidth / 2., sl_z / 2., sl_mat, x_sl.visStr(),
+                                         x_sl.isSensitive() ? sens : SensitiveDetector());
+    if (x_sl.isSensitive()) {
+      sens_sl_names.push_back(sl_name);
+    }
 
     nsl++;
     v_sl_name[nsl]        = sl_name;
@@ -72,22 +75,42 @@ static Ref_t create_detector(Detector& desc, xml_h handle, SensitiveDetector sen
 
   double zpos_0  = -length / 2.;
   int    layerid = 0;
-  for (int ibox = 0; ibox < nbox; ibox++) {
-    for (int ilyr = 0; ilyr < nlyr; ilyr++) {
-      layerid++;
-      for (int isl = 0; isl < nsl; isl++) {
-        string sl_name = v_sl_name[isl + 1];
-
-        double       zpos = zpos_0 + sl_thickness[sl_name] / 2.;
-        Position     sl_pos(0, 0, zpos);
-        PlacedVolume pv = env.placeVolume(slices[sl_name], sl_pos);
-        if (slices[sl_name].isSensitive())
-          pv.addPhysVolID(sl_name, layerid);
-
-        zpos_0 += sl_thickness[sl_name];
+
+  // homogenise the layers of each box into a single volume of the mixture
+  if (dd4hep::getAttrOrDefault<bool>(detElem, _Unicode(homogenize), false)) {
+    auto   mix       = epic::geo::mixLayer(desc, detName + "_layer_mix", x_lyr);
+    double box_thick = nlyr * mix.thickness;
+    Box    box_Shape(xwidth / 2., ywidth / 2., box_thick / 2.);
+    Volume box_Vol("box_vol", box_Shape, mix.material);
+    if (mix.sensitive)
+      box_Vol.setSensitiveDetector(sens);
+
+    for (int ibox = 0; ibox < nbox; ibox++) {
+      // the box is identified by the number of its first layer
+      PlacedVolume pv = env.placeVolume(box_Vol, Position(0, 0, zpos_0 + box_thick / 2.));
+      for (auto& sl_name : sens_sl_names)
+        pv.addPhysVolID(sl_name, layerid + 1);
+      layerid += nlyr;
+      zpos_0 += box_thick + boxgap;
+    }
+  } else {
+    for (int ibox = 0; ibox < nbox; ibox++) {
+      for (int ilyr = 0; ilyr < nlyr; ilyr++) {
+        layerid++;
+        for (int isl = 0; isl < nsl; isl++) {
+          string sl_name = v_sl_name[isl + 1];
+
+          double       zpos = zpos_0 + sl_thickness[sl_name] / 2.;
+          Position     sl_pos(0, 0, zpos);
+          PlacedVolume pv = env.placeVolume(slices[sl_name], sl_pos);
+          if (slices[sl_name].isSensitive())
+            pv.addPhysVolID(sl_name, layerid);
+
+          zpos_0 += sl_thickness[sl_name];
+        }
       }
+      zpos_0 += boxgap;
     }
-    zpos_0 += boxgap;
   }
 
   // detector position and rotation
@@ -0,0 +1,196 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 agent
+
+// Scan the dRICH optics parameters with the analytic model of DRICHOptics.h, without building the
+// detector. Every parameter is given as name=value or as a range name=min:max:n; all combinations are
+// evaluated in parallel and reported as one JSON object per line, in the order of the grid. The values
+// of the current geometry are printed by DRICH_geo at DEBUG print level.
+
+#include "DRICHOptics.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fmt/core.h>
+
+namespace {
+
+  // parameter names, in the order of DRICHOpticsParameters
+  const char* const parameter_names[] = {"zmin", "length", "backplane", "rmin", "rmax", "focus_tune_z",
+                                         "focus_tune_x", "centerx", "centerz", "radius"};
+  constexpr std::size_t n_parameters = sizeof(parameter_names) / sizeof(parameter_names[0]);
+  static_assert(sizeof(epic::geo::DRICHOpticsParameters) == n_parameters * sizeof(double),
+                "parameter names do not match DRICHOpticsParameters");
+
+  void usage(const char* prog)
+  {
+    std::cerr << "Usage: " << prog << " [options] <name>=<value>|<name>=<min>:<max>:<n> ...\n"
+              << "  parameters (cm): zmin length backplane rmin rmax focus_tune_z focus_tune_x centerx centerz radius\n"
+              << "  -j <threads>     number of threads (default: hardware concurrency)\n"
+              << "  -t <min:max:n>   track polar angles in rad (default: 0.06:0.44:20)\n"
+              << "  -c <angle>       Cherenkov angle in rad (default: 0.035)\n"
+              << "  -n <points>      photon emission points along each track (default: 10)\n"
+              << "  -i               also print the image of each track\n";
+    std::exit(EXIT_FAILURE);
+  }
+
+  // JSON number with the given precision, or null if not finite (JSON has no NaN)
+  std::string json_number(double value, int precision)
+  {
+    return std::isfinite(value) ? fmt::format("{:.{}f}", value, precision) : "null";
+  }
+
+  // values of "value" or "min:max:n"
+  bool parse_values(const char* s, std::vector<double>& values)
+  {
+    char*  end;
+    double min = std::strtod(s, &end);
+    if (end == s) {
+      return false;
+    }
+    if (*end == '\0') {
+      values = {min};
+      return true;
+    }
+    if (*end != ':') {
+      return false;
+    }
+    const char* max_begin = end + 1;
+    double      max       = std::strtod(max_begin, &end);
+    if (end == max_begin || *end != ':') {
+      return false;
+    }
+    long n = std::strtol(end + 1, &end, 10);
+    if (*end != '\0' || n < 1) {
+      return false;
+    }
+    values.clear();
+    for (long i = 0; i < n; ++i) {
+      values.push_back(n == 1 ? min : min + i * (max - min) / (n - 1));
+    }
+    return true;
+  }
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  int                 nthreads = std::max(1u, std::thread::hardware_concurrency());
+  std::vector<double> thetas;
+  parse_values("0.06:0.44:20", thetas);
+  double cherenkov_angle = 0.035;
+  int    points          = 10;
+  bool   print_images    = false;
+
+  std::vector<std::vector<double>> grid(n_parameters);
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+      nthreads = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+      if (!parse_values(argv[++i], thetas)) {
+        usage(argv[0]);
+      }
+    } else if (std::strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+      cherenkov_angle = std::atof(argv[++i]);
+    } else if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+      points = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "-i") == 0) {
+      print_images = true;
+    } else {
+      const char* eq   = std::strchr(argv[i], '=');
+      std::string name = eq == nullptr ? "" : std::string(argv[i], eq - argv[i]);
+      auto        it   = std::find(std::begin(parameter_names), std::end(parameter_names), name);
+      if (it == std::end(parameter_names) || !parse_values(eq + 1, grid[it - std::begin(parameter_names)])) {
+        usage(argv[0]);
+      }
+    }
+  }
+  std::size_t n_sets = 1;
+  for (std::size_t k = 0; k < n_parameters; ++k) {
+    if (grid[k].empty()) {
+      std::cerr << "missing parameter " << parameter_names[k] << '\n';
+      usage(argv[0]);
+    }
+    n_sets *= grid[k].size();
+  }
+  if (nthreads < 1 || points < 2) {
+    usage(argv[0]);
+  }
+
+  // each parameter set is formatted by the thread that evaluates it, and printed in grid order
+  std::vector<std::string> lines(n_sets);
+  std::atomic_size_t       next{0};
+  auto                     worker = [&] {
+    for (std::size_t s = next++; s < n_sets; s = next++) {
+      // grid index to parameter values, the last parameter varies fastest
+      double      values[n_parameters];
+      std::size_t index = s;
+      for (std::size_t k = n_parameters; k-- > 0;) {
+        values[k] = grid[k][index % grid[k].size()];
+        index /= grid[k].size();
+      }
+      epic::geo::DRICHOpticsParameters p{values[0], values[1], values[2], values[3], values[4],
+                                         values[5], values[6], values[7], values[8], values[9]};
+      auto mirror = epic::geo::drichMirror(p);
+      auto images = epic::geo::drichImages(p, thetas, cherenkov_angle, points);
+
+      // summary over the accepted tracks
+      std::size_t accepted = 0, focused = 0;
+      double      blur_sum = 0, blur_max = 0, focus_sum2 = 0;
+      for (const auto& image : images) {
+        if (image.accepted) {
+          ++accepted;
+          blur_sum += image.blur;
+          blur_max = std::max(blur_max, image.blur);
+          // the focus is undefined (NaN) if the reflected rays are parallel
+          if (std::isfinite(image.focus_distance)) {
+            ++focused;
+            focus_sum2 += image.focus_distance * image.focus_distance;
+          }
+        }
+      }
+
+      std::string line = "{";
+      for (std::size_t k = 0; k < n_parameters; ++k) {
+        line += fmt::format("\"{}\": {}, ", parameter_names[k], values[k]);
+      }
+      line += fmt::format("\"mirror_center_x\": {:.4f}, \"mirror_center_z\": {:.4f}, \"mirror_radius\": {:.4f}, "
+                          "\"acceptance\": {:.4f}, \"blur_mean\": {:.5f}, \"blur_max\": {:.5f}, "
+                          "\"focus_distance_rms\": {}",
+                          mirror.center_x, mirror.center_z, mirror.radius,
+                          static_cast<double>(accepted) / images.size(), accepted ? blur_sum / accepted : 0.,
+                          blur_max, json_number(focused ? std::sqrt(focus_sum2 / focused) : NAN, 4));
+      if (print_images) {
+        line += ", \"images\": [";
+        for (std::size_t i = 0; i < images.size(); ++i) {
+          const auto& image = images[i];
+          line += fmt::format("{}{{\"theta\": {:.5f}, \"accepted\": {}, \"x\": {:.4f}, \"z\": {:.4f}, "
+                              "\"ring_radius\": {:.4f}, \"blur\": {:.5f}, \"focus_distance\": {}}}",
+                              i > 0 ? ", " : "", image.theta, image.accepted, image.x, image.z, image.ring_radius,
+                              image.blur, json_number(image.focus_distance, 4));
+        }
+        line += "]";
+      }
+      lines[s] = line + "}";
+    }
+  };
+  std::vector<std::thread> threads;
+  for (int i = 0; i < nthreads; ++i) {
+    threads.emplace_back(worker);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (const auto& line : lines) {
+    std::cout << line << '\n';
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,255 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 agent
+
+// Convert detector configurations into ACTS tracking geometries, and report the conversion time,
+// the number of tracking volumes, layers and surfaces, and the memory used, as one JSON object per
+// configuration. Every configuration is checked in a process of its own, so the memory counters are
+// those of that configuration only. The exit code is non-zero if any conversion fails or emits warnings
+// or errors.
+
+#include "DD4hep/Detector.h"
+#include "DD4hep/Printout.h"
+
+#include "Acts/Geometry/Layer.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Plugins/DD4hep/ConvertDD4hepDetector.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/core.h>
+
+namespace {
+
+  struct Result {
+    std::string compact;
+    bool        converted  = false;
+    double      load_s     = 0;
+    double      convert_s  = 0;
+    long        rss_kb     = 0;
+    long        rss_max_kb = 0;
+    std::size_t volumes    = 0;
+    std::size_t layers     = 0;
+    std::size_t surfaces   = 0;
+    std::size_t warnings   = 0;
+    std::size_t errors     = 0;
+  };
+
+  // read a memory counter (e.g. VmRSS, VmHWM) of this process in kB, 0 if not available
+  long memory_kb(const char* key)
+  {
+    std::ifstream status("/proc/self/status");
+    std::string   line;
+    while (std::getline(status, line)) {
+      if (line.compare(0, std::strlen(key), key) == 0 && line[std::strlen(key)] == ':') {
+        return std::strtol(line.c_str() + std::strlen(key) + 1, nullptr, 10);
+      }
+    }
+    return 0;
+  }
+
+  // count tracking volumes and layers below a tracking volume
+  void count_volumes(const Acts::TrackingVolume& volume, Result& result)
+  {
+    ++result.volumes;
+    if (const auto* layers = volume.confinedLayers(); layers != nullptr) {
+      for (const auto& layer : layers->arrayObjects()) {
+        // navigation layers fill the gaps between the layers built from the detector elements
+        if (layer->layerType() != Acts::navigation) {
+          ++result.layers;
+        }
+      }
+    }
+    if (const auto volumes = volume.confinedVolumes(); volumes != nullptr) {
+      for (const auto& daughter : volumes->arrayObjects()) {
+        count_volumes(*daughter, result);
+      }
+    }
+  }
+
+  // count the lines of the ACTS log with the given level, as printed by the default logger
+  std::size_t count_level(const std::string& log, const char* level)
+  {
+    std::istringstream in(log);
+    std::string        line;
+    std::size_t        n = 0;
+    while (std::getline(in, line)) {
+      if (line.find(level) != std::string::npos) {
+        ++n;
+      }
+    }
+    return n;
+  }
+
+  Result check(const std::string& compact, Acts::Logging::Level level, bool print_log)
+  {
+    using clock = std::chrono::steady_clock;
+
+    Result result;
+    result.compact = compact;
+
+    auto detector = dd4hep::Detector::make_unique(compact);
+    auto t0       = clock::now();
+    detector->fromCompact(compact);
+    auto t1 = clock::now();
+
+    // capture the ACTS log to check for warnings
+    std::ostringstream                            log;
+    auto                                          logger = Acts::getDefaultLogger("epic_acts_check", level, &log);
+    std::unique_ptr<const Acts::TrackingGeometry> geometry;
+    try {
+      geometry = Acts::convertDD4hepDetector(detector->world(), *logger);
+    } catch (const std::exception& e) {
+      log << "ERROR " << e.what() << '\n';
+    }
+    auto t2 = clock::now();
+
+    if (print_log) {
+      std::cerr << log.str();
+    }
+
+    result.load_s     = std::chrono::duration<double>(t1 - t0).count();
+    result.convert_s  = std::chrono::duration<double>(t2 - t1).count();
+    result.rss_kb     = memory_kb("VmRSS");
+    result.rss_max_kb = memory_kb("VmHWM");
+    result.warnings   = count_level(log.str(), "WARNING");
+    result.errors     = count_level(log.str(), "ERROR") + count_level(log.str(), "FATAL");
+    if (geometry != nullptr && geometry->highestTrackingVolume() != nullptr) {
+      result.converted = true;
+      count_volumes(*geometry->highestTrackingVolume(), result);
+      geometry->visitSurfaces([&result](const Acts::Surface*) { ++result.surfaces; });
+    }
+    return result;
+  }
+
+  // result of a configuration which could not be checked
+  Result failed(const std::string& compact)
+  {
+    Result result;
+    result.compact = compact;
+    return result;
+  }
+
+  std::string to_json(const Result& r)
+  {
+    return fmt::format("{{\"compact\": \"{}\", \"converted\": {}, \"load_s\": {:.3f}, \"convert_s\": {:.3f}, "
+                       "\"rss_kb\": {}, \"rss_max_kb\": {}, \"volumes\": {}, \"layers\": {}, \"surfaces\": {}, "
+                       "\"warnings\": {}, \"errors\": {}}}",
+                       r.compact, r.converted, r.load_s, r.convert_s, r.rss_kb, r.rss_max_kb, r.volumes, r.layers,
+                       r.surfaces, r.warnings, r.errors);
+  }
+
+  // check a configuration in a child process, returns its JSON line and whether it passed
+  std::pair<std::string, bool> check_in_child(const std::string& compact, Acts::Logging::Level level, bool print_log)
+  {
+    int fds[2];
+    if (::pipe(fds) != 0) {
+      return {to_json(failed(compact)), false};
+    }
+    std::cout.flush();
+    pid_t pid = ::fork();
+    if (pid == 0) {
+      ::close(fds[0]);
+      Result      r    = check(compact, level, print_log);
+      std::string json = to_json(r);
+      bool        ok   = r.converted && r.warnings == 0 && r.errors == 0;
+      for (std::size_t done = 0; done < json.size();) {
+        ssize_t n = ::write(fds[1], json.data() + done, json.size() - done);
+        if (n <= 0) {
+          break;
+        }
+        done += n;
+      }
+      std::cerr.flush();
+      std::_Exit(ok ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+    ::close(fds[1]);
+    std::string json;
+    char        buffer[4096];
+    for (ssize_t n; pid > 0 && (n = ::read(fds[0], buffer, sizeof(buffer))) != 0;) {
+      if (n < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        break;
+      }
+      json.append(buffer, n);
+    }
+    ::close(fds[0]);
+    int status = 0;
+    if (pid < 0 || ::waitpid(pid, &status, 0) != pid) {
+      status = -1;
+    }
+    bool ok = WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS;
+    if (json.empty()) {
+      // the child died before reporting, e.g. in the conversion
+      json = to_json(failed(compact));
+    }
+    return {json, ok};
+  }
+
+  void usage(const char* prog)
+  {
+    std::cerr << "Usage: " << prog << " [-v] [-o <output.json>] <compact.xml> [<compact.xml> ...]\n"
+              << "  -v             print the (verbose) ACTS conversion log to stderr\n"
+              << "  -o <file>      also write the results to a file, one JSON object per line\n";
+    std::exit(EXIT_FAILURE);
+  }
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  bool                     verbose = false;
+  std::string              output;
+  std::vector<std::string> compacts;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "-v") == 0) {
+      verbose = true;
+    } else if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      output = argv[++i];
+    } else if (argv[i][0] == '-') {
+      usage(argv[0]);
+    } else {
+      compacts.emplace_back(argv[i]);
+    }
+  }
+  if (compacts.empty()) {
+    usage(argv[0]);
+  }
+
+  dd4hep::setPrintLevel(dd4hep::WARNING);
+  auto level = verbose ? Acts::Logging::VERBOSE : Acts::Logging::INFO;
+
+  std::ofstream out;
+  if (!output.empty()) {
+    out.open(output);
+  }
+
+  bool ok = true;
+  for (const auto& compact : compacts) {
+    auto [json, passed] = check_in_child(compact, level, verbose);
+    std::cout << json << std::endl;
+    if (out.is_open()) {
+      out << json << '\n';
+    }
+    ok = ok && passed;
+  }
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,368 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2026 agent
+
+// Precompute an ACTS material map of the tracking layers from the detector geometry. The detector is
+// converted into an ACTS tracking geometry, and the material of every layer with a proto surface material
+// is ray-scanned from the TGeo geometry onto the binning of that proto material. The result is written in
+// the ACTS JSON material map schema (CBOR if the output ends in .cbor), as read by the material decorator
+// of the reconstruction, e.g. as calibrations/materials-map.cbor.
+
+#include "DD4hep/DD4hepUnits.h"
+#include "DD4hep/Detector.h"
+#include "DD4hep/Printout.h"
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/ApproachDescriptor.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/Layer.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Material/BinnedSurfaceMaterial.hpp"
+#include "Acts/Material/Material.hpp"
+#include "Acts/Material/MaterialSlab.hpp"
+#include "Acts/Material/ProtoSurfaceMaterial.hpp"
+#include "Acts/Plugins/DD4hep/ConvertDD4hepDetector.hpp"
+#include "Acts/Plugins/Json/MaterialMapJsonConverter.hpp"
+#include "Acts/Surfaces/CylinderBounds.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/BinAdjustment.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include "TGeoManager.h"
+#include "TGeoMaterial.h"
+#include "TGeoNavigator.h"
+#include "TGeoNode.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "BinaryFile.h"
+
+namespace {
+
+  // material accumulated along a ray, in TGeo units (cm, g/cm3)
+  struct PathMaterial {
+    double length = 0;
+    double x0     = 0; // length / X0
+    double l0     = 0; // length / L0
+    double rho    = 0; // length * density
+    double rho_a  = 0; // length * density * A
+    double rho_z  = 0; // length * density * Z
+
+    void add(const TGeoMaterial* mat, double step)
+    {
+      if (mat == nullptr || step <= 0 || mat->GetDensity() <= 0) {
+        return;
+      }
+      length += step;
+      x0 += step / mat->GetRadLen();
+      l0 += step / mat->GetIntLen();
+      rho += step * mat->GetDensity();
+      rho_a += step * mat->GetDensity() * mat->GetA();
+      rho_z += step * mat->GetDensity() * mat->GetZ();
+    }
+
+    void add(const PathMaterial& other)
+    {
+      length += other.length;
+      x0 += other.x0;
+      l0 += other.l0;
+      rho += other.rho;
+      rho_a += other.rho_a;
+      rho_z += other.rho_z;
+    }
+  };
+
+  // a surface with a proto material, with the slice of its layer which is scanned onto it
+  struct ScanSurface {
+    const Acts::Surface*      surface = nullptr;
+    Acts::BinUtility          binning;
+    bool                      cylinder = true; // rays along r (cylinder) or along z (disc)
+    double                    lo = 0, hi = 0;  // slice in local r (cylinder) or local z (disc), in mm
+    std::vector<std::size_t>  bins;            // number of bins in each binning dimension
+    std::pair<double, double> phi, pos;        // full range in phi, and in z (cylinder) or r (disc)
+    Acts::MaterialSlabMatrix  slabs;           // [bin1][bin0]
+  };
+
+  // integrate the material along a straight segment in the world frame (TGeo units)
+  PathMaterial trace(TGeoNavigator* nav, const double* start, const double* dir, double length)
+  {
+    PathMaterial path;
+    nav->InitTrack(start, dir);
+    double travelled = 0;
+    while (travelled < length && !nav->IsOutside()) {
+      const TGeoNode*     node = nav->GetCurrentNode();
+      const TGeoMaterial* mat  = node != nullptr ? node->GetVolume()->GetMaterial() : nullptr;
+      nav->FindNextBoundaryAndStep(length - travelled);
+      double step = std::min(nav->GetStep(), length - travelled);
+      if (step <= 0) {
+        // stuck on a boundary, push through
+        step = TGeoShape::Tolerance();
+        nav->SetStep(step);
+        nav->Step(kFALSE);
+      }
+      path.add(mat, step);
+      travelled += step;
+    }
+    return path;
+  }
+
+  // lower and upper edge of a bin in the dimension with the given binning value, or the full range if not binned
+  std::pair<double, double> bin_edges(const Acts::BinUtility& binning, Acts::BinningValue value,
+                                      const std::vector<std::size_t>& index, std::pair<double, double> full)
+  {
+    const auto& data = binning.binningData();
+    for (std::size_t d = 0; d < data.size(); ++d) {
+      if (data[d].binvalue == value) {
+        double width = (data[d].max - data[d].min) / data[d].bins();
+        return {data[d].min + index[d] * width, data[d].min + (index[d] + 1) * width};
+      }
+    }
+    return full;
+  }
+
+  // scan one bin with samples x samples rays at fixed positions inside the bin
+  Acts::MaterialSlab scan_bin(TGeoNavigator* nav, const Acts::GeometryContext& gctx, const ScanSurface& s,
+                              const std::vector<std::size_t>& index, int samples)
+  {
+    const auto& transform = s.surface->transform(gctx);
+    auto        phi       = bin_edges(s.binning, Acts::binPhi, index, s.phi);
+    auto        pos       = bin_edges(s.binning, s.cylinder ? Acts::binZ : Acts::binR, index, s.pos);
+
+    PathMaterial total;
+    for (int i = 0; i < samples; ++i) {
+      for (int j = 0; j < samples; ++j) {
+        double        u = phi.first + (i + 0.5) / samples * (phi.second - phi.first);
+        double        v = pos.first + (j + 0.5) / samples * (pos.second - pos.first);
+        Acts::Vector3 local_start, local_dir;
+        if (s.cylinder) {
+          local_start = {s.lo * std::cos(u), s.lo * std::sin(u), v};
+          local_dir   = {std::cos(u), std::sin(u), 0};
+        } else {
+          local_start = {v * std::cos(u), v * std::sin(u), s.lo};
+          local_dir   = {0, 0, 1};
+        }
+        Acts::Vector3 start       = transform * local_start;
+        Acts::Vector3 dir         = transform.linear() * local_dir;
+        double        start_cm[3] = {start.x() * dd4hep::mm, start.y() * dd4hep::mm, start.z() * dd4hep::mm};
+        double        dir_cm[3]   = {dir.x(), dir.y(), dir.z()};
+        total.add(trace(nav, start_cm, dir_cm, (s.hi - s.lo) * dd4hep::mm));
+      }
+    }
+
+    // average over the rays, the slab thickness is the mean path length through material
+    if (total.length <= 0) {
+      return Acts::MaterialSlab();
+    }
+    using Acts::UnitConstants::cm3;
+    using Acts::UnitConstants::g;
+    double n        = samples * samples;
+    auto   material = Acts::Material::fromMassDensity(total.length / total.x0 / dd4hep::mm,
+                                                      total.length / total.l0 / dd4hep::mm, total.rho_a / total.rho,
+                                                      total.rho_z / total.rho, total.rho / total.length * g / cm3);
+    return Acts::MaterialSlab(material, total.length / n / dd4hep::mm);
+  }
+
+  // extent of a layer in local r (cylinder) or local z (disc) of one of its surfaces, in mm
+  std::pair<double, double> layer_extent(const Acts::GeometryContext& gctx, const Acts::Layer& layer,
+                                         const Acts::Surface& surface, bool cylinder)
+  {
+    const Acts::Surface& repr = layer.surfaceRepresentation();
+    double               half = 0.5 * layer.thickness();
+    double               mid  = 0;
+    if (cylinder) {
+      mid = static_cast<const Acts::CylinderBounds&>(repr.bounds()).get(Acts::CylinderBounds::eR);
+    } else {
+      mid = (surface.transform(gctx).inverse() * repr.center(gctx)).z();
+    }
+    return {mid - half, mid + half};
+  }
+
+  // number of approach surfaces of a layer with a proto surface material
+  std::size_t approach_materials(const Acts::Layer& layer)
+  {
+    std::size_t n = 0;
+    if (const auto* approach = layer.approachDescriptor(); approach != nullptr) {
+      for (const auto* surface : approach->containedSurfaces()) {
+        if (dynamic_cast<const Acts::ProtoSurfaceMaterial*>(surface->surfaceMaterial()) != nullptr) {
+          ++n;
+        }
+      }
+    }
+    return n;
+  }
+
+  /* set up the scan of a surface with a proto material
+   *
+   * The representing surface of a layer takes the material of the whole layer. An approach surface takes
+   * the half of the layer on its side if the approach surface on the other side has a proto material too,
+   * and the whole layer otherwise. Boundary and sensitive surfaces are not scanned.
+   */
+  bool setup(const Acts::GeometryContext& gctx, const Acts::Surface& surface, ScanSurface& s)
+  {
+    const auto* proto = dynamic_cast<const Acts::ProtoSurfaceMaterial*>(surface.surfaceMaterial());
+    const auto* layer = surface.associatedLayer();
+    const auto& id    = surface.geometryId();
+    if (proto == nullptr) {
+      return false;
+    }
+    if (layer == nullptr || id.sensitive() != 0 || id.boundary() != 0) {
+      dd4hep::printout(dd4hep::WARNING, "epic_material_map", "%llu: not a layer surface, not scanned",
+                       static_cast<unsigned long long>(id.value()));
+      return false;
+    }
+    if (surface.type() != Acts::Surface::Cylinder && surface.type() != Acts::Surface::Disc) {
+      dd4hep::printout(dd4hep::WARNING, "epic_material_map", "%llu: not a cylinder or disc surface, not scanned",
+                       static_cast<unsigned long long>(id.value()));
+      return false;
+    }
+    s.surface  = &surface;
+    s.cylinder = surface.type() == Acts::Surface::Cylinder;
+    s.binning  = Acts::adjustBinUtility(proto->binning(), surface, gctx);
+    for (const auto& data : s.binning.binningData()) {
+      s.bins.push_back(data.bins());
+    }
+    s.bins.resize(2, 1);
+    s.slabs.assign(s.bins[1], Acts::MaterialSlabVector(s.bins[0]));
+    // full extent of the surface, for a proto material which bins only one direction
+    Acts::BinUtility one_bin(1, -M_PI, M_PI, Acts::closed, Acts::binPhi);
+    one_bin += Acts::BinUtility(1, 0., 1., Acts::open, s.cylinder ? Acts::binZ : Acts::binR);
+    auto full = Acts::adjustBinUtility(one_bin, surface, gctx);
+    s.phi     = {full.binningData()[0].min, full.binningData()[0].max};
+    s.pos     = {full.binningData()[1].min, full.binningData()[1].max};
+
+    auto [lo, hi] = layer_extent(gctx, *layer, surface, s.cylinder);
+    s.lo = lo;
+    s.hi = hi;
+    if (id.approach() != 0 && approach_materials(*layer) > 1) {
+      // local radius or z of the approach surface relative to the middle of the layer
+      double here = s.cylinder ? static_cast<const Acts::CylinderBounds&>(surface.bounds()).get(Acts::CylinderBounds::eR)
+                               : 0.;
+      double mid  = 0.5 * (lo + hi);
+      (here < mid ? s.hi : s.lo) = mid;
+    }
+    return true;
+  }
+
+  void usage(const char* prog)
+  {
+    std::cerr << "Usage: " << prog << " [-j <threads>] [-s <samples>] -o <output.json|output.cbor> <compact.xml>\n"
+              << "  -o <file>      ACTS material map, CBOR if it ends in .cbor and JSON otherwise\n"
+              << "  -j <threads>   number of threads (default: hardware concurrency)\n"
+              << "  -s <samples>   rays per bin in each direction (default: 2)\n";
+    std::exit(EXIT_FAILURE);
+  }
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  std::string output, compact;
+  int         nthreads = std::max(1u, std::thread::hardware_concurrency());
+  int         samples  = 2;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      output = argv[++i];
+    } else if (std::strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+      nthreads = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+      samples = std::atoi(argv[++i]);
+    } else if (argv[i][0] == '-' || !compact.empty()) {
+      usage(argv[0]);
+    } else {
+      compact = argv[i];
+    }
+  }
+  if (output.empty() || compact.empty() || nthreads < 1 || samples < 1) {
+    usage(argv[0]);
+  }
+
+  dd4hep::setPrintLevel(dd4hep::WARNING);
+  auto detector = dd4hep::Detector::make_unique(compact);
+  detector->fromCompact(compact);
+  auto logger   = Acts::getDefaultLogger("epic_material_map", Acts::Logging::WARNING);
+  auto geometry = Acts::convertDD4hepDetector(detector->world(), *logger);
+  if (geometry == nullptr) {
+    std::cerr << "Cannot convert " << compact << " into a tracking geometry\n";
+    return EXIT_FAILURE;
+  }
+
+  Acts::GeometryContext    gctx;
+  std::vector<ScanSurface> surfaces;
+  geometry->visitSurfaces([&](const Acts::Surface* surface) {
+    ScanSurface s;
+    if (surface != nullptr && setup(gctx, *surface, s)) {
+      surfaces.push_back(std::move(s));
+    }
+  });
+
+  // flat list of (surface, bin) tasks, each task writes only its own slab so the result does not
+  // depend on the number of threads or the scheduling
+  std::vector<std::pair<std::size_t, std::size_t>> tasks;
+  for (std::size_t s = 0; s < surfaces.size(); ++s) {
+    for (std::size_t b = 0; b < surfaces[s].bins[0] * surfaces[s].bins[1]; ++b) {
+      tasks.emplace_back(s, b);
+    }
+  }
+
+  TGeoManager&       mgr = detector->manager();
+  std::atomic_size_t next{0};
+  auto               worker = [&](TGeoNavigator* nav) {
+    for (std::size_t t = next++; t < tasks.size(); t = next++) {
+      auto&                    s = surfaces[tasks[t].first];
+      std::vector<std::size_t> index{tasks[t].second % s.bins[0], tasks[t].second / s.bins[0]};
+      s.slabs[index[1]][index[0]] = scan_bin(nav, gctx, s, index, samples);
+    }
+  };
+  if (nthreads == 1) {
+    worker(mgr.GetCurrentNavigator());
+  } else {
+    mgr.SetMaxThreads(nthreads);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < nthreads; ++i) {
+      threads.emplace_back([&] { worker(mgr.AddNavigator()); });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    // drop the navigators of the worker threads and return the manager to single-threaded use
+    mgr.ClearThreadsMap();
+    mgr.SetMaxThreads(0);
+  }
+
+  Acts::MaterialMapJsonConverter::DetectorMaterialMaps maps;
+  for (auto& s : surfaces) {
+    maps.first[s.surface->geometryId()] =
+        std::make_shared<const Acts::BinnedSurfaceMaterial>(s.binning, std::move(s.slabs));
+  }
+  Acts::MaterialMapJsonConverter converter(Acts::MaterialMapJsonConverter::Config(), Acts::Logging::WARNING);
+  nlohmann::json                 json = converter.materialMapsToJson(maps);
+
+  bool        cbor = output.size() > 5 && output.compare(output.size() - 5, 5, ".cbor") == 0;
+  std::string contents;
+  if (cbor) {
+    std::vector<std::uint8_t> bytes = nlohmann::json::to_cbor(json);
+    contents.assign(bytes.begin(), bytes.end());
+  } else {
+    contents = json.dump(2);
+  }
+  if (!epic::geo::writeFileAtomic(output, contents)) {
+    std::cerr << "Cannot write " << output << '\n';
+    return EXIT_FAILURE;
+  }
+  std::cout << "Wrote " << surfaces.size() << " surface material maps with " << tasks.size() << " bins to " << output
+            << '\n';
+  return EXIT_SUCCESS;
+}